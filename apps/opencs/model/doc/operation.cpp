@@ -1,6 +1,7 @@
 #include "operation.hpp"
 
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <QTimer>
@@ -9,6 +10,7 @@
 
 #include "state.hpp"
 #include "stage.hpp"
+#include "parallelstages.hpp"
 
 void CSMDoc::Operation::prepareStages()
 {
@@ -23,19 +25,26 @@ void CSMDoc::Operation::prepareStages()
         iter->second = iter->first->setup();
         mTotalSteps += iter->second;
     }
+
+    int threads = mThreads>0 ? mThreads : static_cast<int> (std::thread::hardware_concurrency());
+
+    if (!mOrdered && !mFinalAlways && threads>1)
+        mParallelStages.reset (new ParallelStages (mStages, threads, mDefaultSeverity));
 }
 
 CSMDoc::Operation::Operation (int type, bool ordered, bool finalAlways)
 : mType (type), mStages(std::vector<std::pair<Stage *, int> >()), mCurrentStage(mStages.begin()),
   mCurrentStep(0), mCurrentStepTotal(0), mTotalSteps(0), mOrdered (ordered),
   mFinalAlways (finalAlways), mError(false), mConnected (false), mPrepared (false),
-  mDefaultSeverity (Message::Severity_Error)
+  mDefaultSeverity (Message::Severity_Error), mThreads (1)
 {
     mTimer = new QTimer (this);
 }
 
 CSMDoc::Operation::~Operation()
 {
+    mParallelStages.reset();
+
     for (std::vector<std::pair<Stage *, int> >::iterator iter (mStages.begin()); iter!=mStages.end(); ++iter)
         delete iter->first;
 }
@@ -65,6 +74,11 @@ void CSMDoc::Operation::setDefaultSeverity (Message::Severity severity)
     mDefaultSeverity = severity;
 }
 
+void CSMDoc::Operation::setThreadCount (int threads)
+{
+    mThreads = threads;
+}
+
 bool CSMDoc::Operation::hasError() const
 {
     return mError;
@@ -77,7 +91,12 @@ void CSMDoc::Operation::abort()
 
     mError = true;
 
-    if (mFinalAlways)
+    if (mParallelStages)
+    {
+        mParallelStages->abort();
+        mCurrentStage = mStages.end();
+    }
+    else if (mFinalAlways)
     {
         if (mStages.begin()!=mStages.end() && mCurrentStage!=--mStages.end())
         {
@@ -99,27 +118,46 @@ void CSMDoc::Operation::executeStage()
 
     Messages messages (mDefaultSeverity);
 
-    while (mCurrentStage!=mStages.end())
+    if (mParallelStages)
     {
-        if (mCurrentStep>=mCurrentStage->second)
+        try
         {
-            mCurrentStep = 0;
-            ++mCurrentStage;
+            if (!mParallelStages->isDone())
+                mCurrentStepTotal += mParallelStages->next (messages);
+        }
+        catch (const std::exception& e)
+        {
+            emit reportMessage (Message (CSMWorld::UniversalId(), e.what(), "", Message::Severity_SeriousError), mType);
+            abort();
         }
-        else
+
+        if (mParallelStages->isDone())
+            mCurrentStage = mStages.end();
+    }
+    else
+    {
+        while (mCurrentStage!=mStages.end())
         {
-            try
+            if (mCurrentStep>=mCurrentStage->second)
             {
-                mCurrentStage->first->perform (mCurrentStep++, messages);
+                mCurrentStep = 0;
+                ++mCurrentStage;
             }
-            catch (const std::exception& e)
+            else
             {
-                emit reportMessage (Message (CSMWorld::UniversalId(), e.what(), "", Message::Severity_SeriousError), mType);
-                abort();
+                try
+                {
+                    mCurrentStage->first->perform (mCurrentStep++, messages);
+                }
+                catch (const std::exception& e)
+                {
+                    emit reportMessage (Message (CSMWorld::UniversalId(), e.what(), "", Message::Severity_SeriousError), mType);
+                    abort();
+                }
+
+                ++mCurrentStepTotal;
+                break;
             }
-
-            ++mCurrentStepTotal;
-            break;
         }
     }
 
@@ -135,5 +173,6 @@ void CSMDoc::Operation::executeStage()
 void CSMDoc::Operation::operationDone()
 {
     mTimer->stop();
+    mParallelStages.reset();
     emit done (mType, mError);
 }
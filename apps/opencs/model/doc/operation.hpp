@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 
 #include <QObject>
 #include <QTimer>
@@ -18,6 +19,7 @@ namespace CSMWorld
 namespace CSMDoc
 {
     class Stage;
+    class ParallelStages;
 
     class Operation : public QObject
     {
@@ -36,6 +38,8 @@ namespace CSMDoc
             QTimer *mTimer;
             bool mPrepared;
             Message::Severity mDefaultSeverity;
+            int mThreads;
+            std::unique_ptr<ParallelStages> mParallelStages;
 
             void prepareStages();
 
@@ -55,6 +59,11 @@ namespace CSMDoc
             /// \attention Do no call this function while this Operation is running.
             void setDefaultSeverity (Message::Severity severity);
 
+            /// Number of threads to use for unordered operations (0: one per hardware thread).
+            ///
+            /// \attention Do no call this function while this Operation is running.
+            void setThreadCount (int threads);
+
             bool hasError() const;
 
         signals:
@@ -0,0 +1,141 @@
+#include "parallelstages.hpp"
+
+#include <algorithm>
+
+#include "stage.hpp"
+
+namespace
+{
+    // Small enough to keep progress reports and aborts responsive, large enough to keep the
+    // synchronisation overhead negligible compared to checking the records.
+    const int sStepsPerTask = 64;
+}
+
+CSMDoc::ParallelStages::Task::Task (Stage *stage, int begin, int end, bool deferred,
+    Message::Severity severity)
+: mStage (stage), mBegin (begin), mEnd (end), mDeferred (deferred), mDone (false),
+  mMessages (severity)
+{}
+
+void CSMDoc::ParallelStages::perform (Task& task)
+{
+    try
+    {
+        for (int step = task.mBegin; step<task.mEnd && !mAborted; ++step)
+            task.mStage->perform (step, task.mMessages);
+    }
+    catch (...)
+    {
+        task.mError = std::current_exception();
+    }
+}
+
+void CSMDoc::ParallelStages::run()
+{
+    while (true)
+    {
+        Task *task = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock (mMutex);
+
+            while (mNextTask<mTasks.size() && mTasks[mNextTask].mDeferred)
+                ++mNextTask;
+
+            if (mAborted || mNextTask>=mTasks.size())
+                return;
+
+            task = &mTasks[mNextTask++];
+        }
+
+        perform (*task);
+
+        {
+            std::lock_guard<std::mutex> lock (mMutex);
+            task->mDone = true;
+        }
+
+        mTaskDone.notify_all();
+    }
+}
+
+CSMDoc::ParallelStages::ParallelStages (const std::vector<std::pair<Stage *, int> >& stages,
+    int threads, Message::Severity defaultSeverity)
+: mNextTask (0), mNextResult (0), mAborted (false)
+{
+    int workerTasks = 0;
+
+    for (std::vector<std::pair<Stage *, int> >::const_iterator iter (stages.begin());
+        iter!=stages.end(); ++iter)
+    {
+        Stage *stage = iter->first;
+        int steps = iter->second;
+
+        if (steps<=0)
+            continue;
+
+        if (!stage->isThreadSafe())
+        {
+            mTasks.emplace_back (stage, 0, steps, false, defaultSeverity);
+            ++workerTasks;
+            continue;
+        }
+
+        // The last step of a stage often reports on state gathered by all the other steps, so
+        // it is held back until the results of the preceding ranges have been collected.
+        for (int begin = 0; begin<steps-1; begin += sStepsPerTask)
+        {
+            mTasks.emplace_back (stage, begin, std::min (begin+sStepsPerTask, steps-1), false,
+                defaultSeverity);
+            ++workerTasks;
+        }
+
+        mTasks.emplace_back (stage, steps-1, steps, true, defaultSeverity);
+    }
+
+    threads = std::min (threads, workerTasks);
+
+    for (int i = 0; i<threads; ++i)
+        mWorkers.emplace_back (&ParallelStages::run, this);
+}
+
+CSMDoc::ParallelStages::~ParallelStages()
+{
+    abort();
+}
+
+bool CSMDoc::ParallelStages::isDone() const
+{
+    return mAborted || mNextResult>=mTasks.size();
+}
+
+int CSMDoc::ParallelStages::next (Messages& messages)
+{
+    Task& task = mTasks[mNextResult++];
+
+    if (task.mDeferred)
+        perform (task);
+    else
+    {
+        std::unique_lock<std::mutex> lock (mMutex);
+        mTaskDone.wait (lock, [&task] { return task.mDone; });
+    }
+
+    if (task.mError)
+        std::rethrow_exception (task.mError);
+
+    for (Messages::Iterator iter (task.mMessages.begin()); iter!=task.mMessages.end(); ++iter)
+        messages.add (iter->mId, iter->mMessage, iter->mHint, iter->mSeverity);
+
+    return task.mEnd-task.mBegin;
+}
+
+void CSMDoc::ParallelStages::abort()
+{
+    mAborted = true;
+
+    for (std::vector<std::thread>::iterator iter (mWorkers.begin()); iter!=mWorkers.end(); ++iter)
+        iter->join();
+
+    mWorkers.clear();
+}
@@ -0,0 +1,75 @@
+#ifndef CSM_DOC_PARALLELSTAGES_H
+#define CSM_DOC_PARALLELSTAGES_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "messages.hpp"
+
+namespace CSMDoc
+{
+    class Stage;
+
+    /// \brief Performs the steps of independent stages on a set of worker threads
+    ///
+    /// Stages that are not thread-safe are performed as a whole by a single worker. The steps of
+    /// thread-safe stages are split into ranges. Results are handed out in the order the stages
+    /// and steps would have been performed sequentially, so reports do not depend on scheduling.
+    class ParallelStages
+    {
+            struct Task
+            {
+                Stage *mStage;
+                int mBegin;
+                int mEnd;
+                bool mDeferred; // performed by the thread collecting the results
+                bool mDone;
+                Messages mMessages;
+                std::exception_ptr mError;
+
+                Task (Stage *stage, int begin, int end, bool deferred, Message::Severity severity);
+            };
+
+            std::vector<Task> mTasks;
+            std::size_t mNextTask;
+            std::size_t mNextResult;
+            std::atomic<bool> mAborted;
+            std::mutex mMutex;
+            std::condition_variable mTaskDone;
+            std::vector<std::thread> mWorkers;
+
+            void perform (Task& task);
+
+            void run();
+
+        public:
+
+            ParallelStages (const std::vector<std::pair<Stage *, int> >& stages, int threads,
+                Message::Severity defaultSeverity);
+            ///< \param stages Stages that have already been set up, with their number of steps.
+
+            ~ParallelStages();
+
+            ParallelStages (const ParallelStages&) = delete;
+            ParallelStages& operator= (const ParallelStages&) = delete;
+
+            bool isDone() const;
+            ///< Have the results of all steps been collected or has the run been aborted?
+
+            int next (Messages& messages);
+            ///< Wait for the next range of steps and append its messages to \a messages.
+            ///
+            /// \note An exception thrown by a stage is rethrown here.
+            /// \return Number of steps performed.
+
+            void abort();
+            ///< Stop all workers after their current step and wait for them.
+    };
+}
+
+#endif
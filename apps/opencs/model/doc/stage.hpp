@@ -23,6 +23,12 @@ namespace CSMDoc
 
             virtual void perform (int stage, Messages& messages) = 0;
             ///< Messages resulting from this stage will be appended to \a messages.
+
+            virtual bool isThreadSafe() const;
+            ///< May perform() be called concurrently for different steps once setup() has
+            /// returned? The last step is always performed after all other steps have finished.
+            ///
+            /// Default implementation: false
     };
 }
 
@@ -124,6 +124,10 @@ void CSMPrefs::State::declare()
     declareEnum ("double-c", "Control Double Click", actionEditAndRemove).addValues (reportValues);
     declareEnum ("double-sc", "Shift Control Double Click", actionNone).addValues (reportValues);
     declareBool("ignore-base-records", "Ignore base records in verifier", false);
+    declareInt ("verifier-threads", "Verifier threads", 0).
+        setTooltip ("Number of threads used to check records. 0 uses one thread per CPU core, "
+        "1 checks all records on a single thread.").
+        setRange (0, 64);
 
     declareCategory ("Search & Replace");
     declareInt ("char-before", "Characters before search string", 10).
@@ -131,6 +135,9 @@ void CSMPrefs::State::declare()
     declareInt ("char-after", "Characters after search string", 10).
         setTooltip ("Maximum number of character to display in search result after the searched text");
     declareBool ("auto-delete", "Delete row from result table after a successful replace", true);
+    declareInt ("threads", "Search threads", 0).
+        setTooltip ("Number of threads used to search the tables. 0 uses one thread per CPU core.").
+        setRange (0, 64);
 
     declareCategory ("Scripts");
     declareBool ("show-linenum", "Show Line Numbers", true).
@@ -54,3 +54,8 @@ void CSMTools::BodyPartCheckStage::perform (int stage, CSMDoc::Messages &message
             messages.add(id, "Race '" + bodyPart.mRace + "' does not exist", "", CSMDoc::Message::Severity_Error);
     }
 }
+
+bool CSMTools::BodyPartCheckStage::isThreadSafe() const
+{
+    return true;
+}
@@ -80,3 +80,8 @@ void CSMTools::JournalCheckStage::perform(int stage, CSMDoc::Messages& messages)
         messages.add(id, "Multiple entries with quest status 'Named'", "", CSMDoc::Message::Severity_Error);
     }
 }
+
+bool CSMTools::JournalCheckStage::isThreadSafe() const
+{
+    return true;
+}
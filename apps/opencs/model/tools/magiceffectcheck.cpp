@@ -119,3 +119,8 @@ void CSMTools::MagicEffectCheckStage::perform(int stage, CSMDoc::Messages &messa
     if (!effect.mBoltSound.empty() && mSounds.searchId(effect.mBoltSound) == -1)
         messages.add(id, "Bolt sound '" + effect.mBoltSound + "' does not exist", "", CSMDoc::Message::Severity_Error);
 }
+
+bool CSMTools::MagicEffectCheckStage::isThreadSafe() const
+{
+    return true;
+}
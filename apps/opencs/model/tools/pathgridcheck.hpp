@@ -35,6 +35,8 @@ namespace CSMTools
         int setup() override;
 
         void perform (int stage, CSMDoc::Messages& messages) override;
+
+        bool isThreadSafe() const override;
     };
 }
 
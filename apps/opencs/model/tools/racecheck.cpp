@@ -76,3 +76,8 @@ void CSMTools::RaceCheckStage::perform (int stage, CSMDoc::Messages& messages)
     else
         performPerRecord (stage, messages);
 }
+
+bool CSMTools::RaceCheckStage::isThreadSafe() const
+{
+    return true;
+}
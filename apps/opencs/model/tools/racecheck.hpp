@@ -1,6 +1,8 @@
 #ifndef CSM_TOOLS_RACECHECK_H
 #define CSM_TOOLS_RACECHECK_H
 
+#include <atomic>
+
 #include <components/esm/loadrace.hpp>
 
 #include "../world/idcollection.hpp"
@@ -13,7 +15,7 @@ namespace CSMTools
     class RaceCheckStage : public CSMDoc::Stage
     {
             const CSMWorld::IdCollection<ESM::Race>& mRaces;
-            bool mPlayable;
+            std::atomic<bool> mPlayable;
             bool mIgnoreBaseRecords;
 
             void performPerRecord (int stage, CSMDoc::Messages& messages);
@@ -29,6 +31,8 @@ namespace CSMTools
 
             void perform (int stage, CSMDoc::Messages& messages) override;
             ///< Messages resulting from this tage will be appended to \a messages.
+
+            bool isThreadSafe() const override;
     };
 }
 
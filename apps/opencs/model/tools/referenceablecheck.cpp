@@ -1052,3 +1052,8 @@ template<typename Tool> void CSMTools::ReferenceableCheckStage::scriptCheck (
             messages.add(someID, "Script '" + someTool.mScript + "' does not exist", "", CSMDoc::Message::Severity_Error);
     }
 }
+
+bool CSMTools::ReferenceableCheckStage::isThreadSafe() const
+{
+    return true;
+}
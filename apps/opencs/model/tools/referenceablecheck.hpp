@@ -1,6 +1,8 @@
 #ifndef REFERENCEABLECHECKSTAGE_H
 #define REFERENCEABLECHECKSTAGE_H
 
+#include <atomic>
+
 #include "../world/universalid.hpp"
 #include "../doc/stage.hpp"
 #include "../world/data.hpp"
@@ -23,6 +25,7 @@ namespace CSMTools
                 const CSMWorld::IdCollection<ESM::BodyPart>& bodyparts);
 
             void perform(int stage, CSMDoc::Messages& messages) override;
+            bool isThreadSafe() const override;
             int setup() override;
 
         private:
@@ -88,7 +91,7 @@ namespace CSMTools
             const CSMWorld::Resources& mModels;
             const CSMWorld::Resources& mIcons;
             const CSMWorld::IdCollection<ESM::BodyPart>& mBodyParts;
-            bool mPlayerPresent;
+            std::atomic<bool> mPlayerPresent;
             bool mIgnoreBaseRecords;
     };
 }
@@ -15,6 +15,7 @@ namespace CSMTools
                 const CSMWorld::IdCollection<ESM::Faction>& factions);
 
             void perform(int stage, CSMDoc::Messages& messages) override;
+            bool isThreadSafe() const override;
             int setup() override;
 
         private:
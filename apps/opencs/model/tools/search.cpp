@@ -11,51 +11,48 @@
 #include "../world/universalid.hpp"
 #include "../world/commands.hpp"
 
-void CSMTools::Search::searchTextCell (const CSMWorld::IdTableBase *model,
-    const QModelIndex& index, const CSMWorld::UniversalId& id, bool writable,
-    CSMDoc::Messages& messages) const
+void CSMTools::Search::searchTextCell (const QVariant& data, int columnId,
+    const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const
 {
     // using QString here for easier handling of case folding.
-    
-    QString search = QString::fromUtf8 (mText.c_str());
-    QString text = model->data (index).toString();
+
+    QString text = data.toString();
 
     int pos = 0;
 
     Qt::CaseSensitivity caseSensitivity = mCase ? Qt::CaseSensitive : Qt::CaseInsensitive;
-    while ((pos = text.indexOf (search, pos, caseSensitivity))!=-1)
+    while ((pos = text.indexOf (mSearchText, pos, caseSensitivity))!=-1)
     {
         std::ostringstream hint;
         hint
             << (writable ? 'R' : 'r')
             <<": "
-            << model->getColumnId (index.column())
+            << columnId
             << " " << pos
-            << " " << search.length();
+            << " " << mSearchText.length();
         
-        messages.add (id, formatDescription (text, pos, search.length()).toUtf8().data(), hint.str());
+        messages.add (id, formatDescription (text, pos, mSearchText.length()).toUtf8().data(), hint.str());
 
-        pos += search.length();
+        pos += mSearchText.length();
     }
 }
 
-void CSMTools::Search::searchRegExCell (const CSMWorld::IdTableBase *model,
-    const QModelIndex& index, const CSMWorld::UniversalId& id, bool writable,
-    CSMDoc::Messages& messages) const
+void CSMTools::Search::searchRegExCell (QRegExp& regExp, const QVariant& data, int columnId,
+    const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const
 {
-    QString text = model->data (index).toString();
+    QString text = data.toString();
 
     int pos = 0;
 
-    while ((pos = mRegExp.indexIn (text, pos))!=-1)
+    while ((pos = regExp.indexIn (text, pos))!=-1)
     {
-        int length = mRegExp.matchedLength();
+        int length = regExp.matchedLength();
         
         std::ostringstream hint;
         hint
             << (writable ? 'R' : 'r')
             <<": "
-            << model->getColumnId (index.column())
+            << columnId
             << " " << pos
             << " " << length;
         
@@ -65,21 +62,21 @@ void CSMTools::Search::searchRegExCell (const CSMWorld::IdTableBase *model,
     }
 }
 
-void CSMTools::Search::searchRecordStateCell (const CSMWorld::IdTableBase *model,
-    const QModelIndex& index, const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const
+void CSMTools::Search::searchRecordStateCell (const QVariant& data, int columnId,
+    const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const
 {
     if (writable)
         throw std::logic_error ("Record state can not be modified by search and replace");
         
-    int data = model->data (index).toInt();
+    int value = data.toInt();
 
-    if (data==mValue)
+    if (value==mValue)
     {
         std::vector<std::pair<int,std::string>> states =
             CSMWorld::Columns::getEnums (CSMWorld::Columns::ColumnId_Modification);
 
-        const std::string hint = "r: " + std::to_string(model->getColumnId(index.column()));
-        messages.add (id, states.at(data).second, hint);
+        const std::string hint = "r: " + std::to_string (columnId);
+        messages.add (id, states.at(value).second, hint);
     }
 }
 
@@ -120,7 +117,7 @@ CSMTools::Search::Search() : mType (Type_None), mValue (0), mCase (false), mIdCo
     mPaddingBefore (10), mPaddingAfter (10) {}
 
 CSMTools::Search::Search (Type type, bool caseSensitive, const std::string& value)
-: mType (type), mText (value), mValue (0), mCase (caseSensitive), mIdColumn (0), mTypeColumn (0), mPaddingBefore (10), mPaddingAfter (10)
+: mType (type), mText (value), mSearchText (QString::fromUtf8 (value.c_str())), mValue (0), mCase (caseSensitive), mIdColumn (0), mTypeColumn (0), mPaddingBefore (10), mPaddingAfter (10)
 {
     if (type!=Type_Text && type!=Type_Id)
         throw std::logic_error ("Invalid search parameter (string)");
@@ -192,7 +189,7 @@ void CSMTools::Search::configure (const CSMWorld::IdTableBase *model)
         }
 
         if (consider)
-            mColumns.insert (i);
+            mColumns.push_back (std::make_pair (i, model->getColumnId (i)));
     }
 
     mIdColumn = model->findColumnIndex (CSMWorld::Columns::ColumnId_Id);
@@ -202,15 +199,25 @@ void CSMTools::Search::configure (const CSMWorld::IdTableBase *model)
 void CSMTools::Search::searchRow (const CSMWorld::IdTableBase *model, int row,
     CSMDoc::Messages& messages) const
 {
-    for (std::set<int>::const_iterator iter (mColumns.begin()); iter!=mColumns.end(); ++iter)
+    if (mColumns.empty())
+        return;
+
+    CSMWorld::UniversalId::Type type = static_cast<CSMWorld::UniversalId::Type> (
+        model->data (model->index (row, mTypeColumn)).toInt());
+
+    CSMWorld::UniversalId id (
+        type, model->data (model->index (row, mIdColumn)).toString().toUtf8().data());
+
+    // QRegExp keeps its match state in the object; a per-row copy shares the compiled pattern
+    // and allows rows to be searched on different threads.
+    QRegExp regExp (mRegExp);
+
+    for (std::vector<std::pair<int, int> >::const_iterator iter (mColumns.begin());
+        iter!=mColumns.end(); ++iter)
     {
-        QModelIndex index = model->index (row, *iter);
+        QModelIndex index = model->index (row, iter->first);
 
-        CSMWorld::UniversalId::Type type = static_cast<CSMWorld::UniversalId::Type> (
-            model->data (model->index (row, mTypeColumn)).toInt());
-        
-        CSMWorld::UniversalId id (
-            type, model->data (model->index (row, mIdColumn)).toString().toUtf8().data());
+        QVariant data = model->data (index);
 
         bool writable = model->flags (index) & Qt::ItemIsEditable;
             
@@ -219,18 +226,18 @@ void CSMTools::Search::searchRow (const CSMWorld::IdTableBase *model, int row,
             case Type_Text:
             case Type_Id:
 
-                searchTextCell (model, index, id, writable, messages);
+                searchTextCell (data, iter->second, id, writable, messages);
                 break;
             
             case Type_TextRegEx:
             case Type_IdRegEx:
 
-                searchRegExCell (model, index, id, writable, messages);
+                searchRegExCell (regExp, data, iter->second, id, writable, messages);
                 break;
             
             case Type_RecordState:
 
-                searchRecordStateCell (model, index, id, writable, messages);
+                searchRecordStateCell (data, iter->second, id, writable, messages);
                 break;
 
             case Type_None:
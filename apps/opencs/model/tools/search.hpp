@@ -2,12 +2,14 @@
 #define CSM_TOOLS_SEARCH_H
 
 #include <string>
-#include <set>
+#include <utility>
+#include <vector>
 
 #include <QRegExp>
 #include <QMetaType>
 
 class QModelIndex;
+class QVariant;
 
 namespace CSMDoc
 {
@@ -41,24 +43,24 @@ namespace CSMTools
 
             Type mType;
             std::string mText;
+            QString mSearchText;
             QRegExp mRegExp;
             int mValue;
             bool mCase;
-            std::set<int> mColumns;
+            std::vector<std::pair<int, int> > mColumns; // column index, column ID
             int mIdColumn;
             int mTypeColumn;
             int mPaddingBefore;
             int mPaddingAfter;
 
-            void searchTextCell (const CSMWorld::IdTableBase *model, const QModelIndex& index,
+            void searchTextCell (const QVariant& data, int columnId,
                 const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const;
 
-            void searchRegExCell (const CSMWorld::IdTableBase *model, const QModelIndex& index,
+            void searchRegExCell (QRegExp& regExp, const QVariant& data, int columnId,
                 const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const;
 
-            void searchRecordStateCell (const CSMWorld::IdTableBase *model,
-                const QModelIndex& index, const CSMWorld::UniversalId& id, bool writable,
-                CSMDoc::Messages& messages) const;
+            void searchRecordStateCell (const QVariant& data, int columnId,
+                const CSMWorld::UniversalId& id, bool writable, CSMDoc::Messages& messages) const;
 
             QString formatDescription (const QString& description, int pos, int length) const;
 
@@ -79,6 +81,8 @@ namespace CSMTools
 
             // Search row in \a model and store results in \a messages.
             //
+            // Different rows may be searched concurrently, as long as \a model is not modified.
+            //
             // \attention *this needs to be configured for \a model.
             void searchRow (const CSMWorld::IdTableBase *model, int row,
                 CSMDoc::Messages& messages) const;
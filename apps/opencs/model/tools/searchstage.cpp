@@ -23,6 +23,11 @@ void CSMTools::SearchStage::perform (int stage, CSMDoc::Messages& messages)
     mSearch.searchRow (mModel, stage, messages);
 }
 
+bool CSMTools::SearchStage::isThreadSafe() const
+{
+    return true;
+}
+
 void CSMTools::SearchStage::setOperation (const SearchOperation *operation)
 {
     mOperation = operation;
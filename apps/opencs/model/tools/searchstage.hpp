@@ -30,6 +30,8 @@ namespace CSMTools
             void perform (int stage, CSMDoc::Messages& messages) override;
             ///< Messages resulting from this stage will be appended to \a messages.
 
+            bool isThreadSafe() const override;
+
             void setOperation (const SearchOperation *operation);
     };
 }
@@ -25,6 +25,8 @@ namespace CSMTools
 
             void perform(int stage, CSMDoc::Messages &messages) override;
             ///< Messages resulting from this stage will be appended to \a messages.
+
+            bool isThreadSafe() const override;
     };
 }
 
@@ -22,6 +22,7 @@ namespace CSMTools
                 const CSMWorld::IdCollection<ESM::Script>& scripts);
 
             void perform(int stage, CSMDoc::Messages& messages) override;
+            bool isThreadSafe() const override;
             int setup() override;
     };
 }
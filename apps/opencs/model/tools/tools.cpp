@@ -6,6 +6,8 @@
 #include "../doc/operation.hpp"
 #include "../doc/document.hpp"
 
+#include "../prefs/state.hpp"
+
 #include "../world/data.hpp"
 #include "../world/universalid.hpp"
 
@@ -189,7 +191,11 @@ CSMWorld::UniversalId CSMTools::Tools::runVerifier (const CSMWorld::UniversalId&
 
     mActiveReports[CSMDoc::State_Verifying] = reportNumber;
 
-    getVerifier()->start();
+    CSMDoc::OperationHolder *verifier = getVerifier();
+
+    mVerifierOperation->setThreadCount (CSMPrefs::get()["Reports"]["verifier-threads"].toInt());
+
+    verifier->start();
 
     return CSMWorld::UniversalId (CSMWorld::UniversalId::Type_VerificationResults, reportNumber);
 }
@@ -212,6 +218,7 @@ void CSMTools::Tools::runSearch (const CSMWorld::UniversalId& searchId, const Se
     }
 
     mSearchOperation->configure (search);
+    mSearchOperation->setThreadCount (CSMPrefs::get()["Search & Replace"]["threads"].toInt());
 
     mSearch.start();
 }
@@ -2,7 +2,8 @@
 #define CSM_WOLRD_COLLECTION_H
 
 #include <vector>
-#include <map>
+#include <memory>
+#include <unordered_map>
 #include <algorithm>
 #include <cctype>
 #include <stdexcept>
@@ -84,19 +85,26 @@ namespace CSMWorld
 
         private:
 
-            std::vector<Record<ESXRecordT> > mRecords;
-            std::map<std::string, int> mIndex;
+            typedef std::unordered_map<std::string, int, Misc::StringUtils::CiHash,
+                Misc::StringUtils::CiEqual> IdIndex;
+
+            std::vector<std::unique_ptr<Record<ESXRecordT> > > mRecords;
+            IdIndex mIndex;
+            std::vector<typename IdIndex::value_type *> mRowIndex;
+            ///< Index entry of each row (nullptr for a row with a duplicate ID), so that rows can be
+            /// renumbered without looking up their IDs again.
             std::vector<Column<ESXRecordT> *> mColumns;
 
             // not implemented
             Collection (const Collection&);
             Collection& operator= (const Collection&);
 
-        protected:
+            void renumberRows (int begin, int end);
+            ///< Update the index entries of the rows [begin, end).
 
-            const std::map<std::string, int>& getIdMap() const;
+        protected:
 
-            const std::vector<Record<ESXRecordT> >& getRecords() const;
+            const std::vector<std::unique_ptr<Record<ESXRecordT> > >& getRecords() const;
 
             bool reorderRowsImp (int baseIndex, const std::vector<int>& newOrder);
             ///< Reorder the rows [baseIndex, baseIndex+newOrder.size()) according to the indices
@@ -205,13 +213,15 @@ namespace CSMWorld
     };
 
     template<typename ESXRecordT, typename IdAccessorT>
-    const std::map<std::string, int>& Collection<ESXRecordT, IdAccessorT>::getIdMap() const
+    void Collection<ESXRecordT, IdAccessorT>::renumberRows (int begin, int end)
     {
-        return mIndex;
+        for (int i=begin; i<end; ++i)
+            if (mRowIndex[i])
+                mRowIndex[i]->second = i;
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
-    const std::vector<Record<ESXRecordT> >& Collection<ESXRecordT, IdAccessorT>::getRecords() const
+    const std::vector<std::unique_ptr<Record<ESXRecordT> > >& Collection<ESXRecordT, IdAccessorT>::getRecords() const
     {
         return mRecords;
     }
@@ -231,21 +241,21 @@ namespace CSMWorld
                 return false;
 
             // reorder records
-            std::vector<Record<ESXRecordT> > buffer (size);
+            std::vector<std::unique_ptr<Record<ESXRecordT> > > buffer (size);
+            std::vector<typename IdIndex::value_type *> rowIndex (size);
 
             for (int i=0; i<size; ++i)
             {
-                buffer[newOrder[i]] = mRecords [baseIndex+i];
-                buffer[newOrder[i]].setModified (buffer[newOrder[i]].get());
+                buffer[newOrder[i]] = std::move (mRecords [baseIndex+i]);
+                buffer[newOrder[i]]->setModified (buffer[newOrder[i]]->get());
+                rowIndex[newOrder[i]] = mRowIndex[baseIndex+i];
             }
 
-            std::copy (buffer.begin(), buffer.end(), mRecords.begin()+baseIndex);
+            std::move (buffer.begin(), buffer.end(), mRecords.begin()+baseIndex);
+            std::copy (rowIndex.begin(), rowIndex.end(), mRowIndex.begin()+baseIndex);
 
             // adjust index
-            for (std::map<std::string, int>::iterator iter (mIndex.begin()); iter!=mIndex.end();
-                 ++iter)
-                if (iter->second>=baseIndex && iter->second<baseIndex+size)
-                    iter->second = newOrder.at (iter->second-baseIndex)+baseIndex;
+            renumberRows (baseIndex, baseIndex+size);
         }
 
         return true;
@@ -275,7 +285,7 @@ namespace CSMWorld
     int Collection<ESXRecordT, IdAccessorT>::touchRecordImp(const std::string& id)
     {
         int index = getIndex(id);
-        Record<ESXRecordT>& record = mRecords.at(index);
+        Record<ESXRecordT>& record = *mRecords.at(index);
         if (record.isDeleted())
         {
             throw std::runtime_error("attempt to touch deleted record");
@@ -302,7 +312,7 @@ namespace CSMWorld
         const std::string& destination, const UniversalId::Type type)
     {
         int index = cloneRecordImp(origin, destination, type);
-        mRecords.at(index).get().mPlugin = 0;
+        mRecords.at(index)->get().mPlugin = 0;
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -317,7 +327,7 @@ namespace CSMWorld
         int index = touchRecordImp(id);
         if (index >= 0)
         {
-            mRecords.at(index).get().mPlugin = 0;
+            mRecords.at(index)->get().mPlugin = 0;
             return true;
         }
 
@@ -338,9 +348,9 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::add (const ESXRecordT& record)
     {
-        std::string id = Misc::StringUtils::lowerCase (IdAccessorT().getId (record));
+        std::string id = IdAccessorT().getId (record);
 
-        std::map<std::string, int>::iterator iter = mIndex.find (id);
+        typename IdIndex::iterator iter = mIndex.find (id);
 
         if (iter==mIndex.end())
         {
@@ -352,7 +362,7 @@ namespace CSMWorld
         }
         else
         {
-            mRecords[iter->second].setModified (record);
+            mRecords[iter->second]->setModified (record);
         }
     }
 
@@ -365,7 +375,7 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     std::string Collection<ESXRecordT, IdAccessorT>::getId (int index) const
     {
-        return IdAccessorT().getId (mRecords.at (index).get());
+        return IdAccessorT().getId (mRecords.at (index)->get());
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -388,13 +398,13 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     QVariant Collection<ESXRecordT, IdAccessorT>::getData (int index, int column) const
     {
-        return mColumns.at (column)->get (mRecords.at (index));
+        return mColumns.at (column)->get (*mRecords.at (index));
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::setData (int index, int column, const QVariant& data)
     {
-        return mColumns.at (column)->set (mRecords.at (index), data);
+        return mColumns.at (column)->set (*mRecords.at (index), data);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -421,8 +431,8 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::merge()
     {
-        for (typename std::vector<Record<ESXRecordT> >::iterator iter (mRecords.begin()); iter!=mRecords.end(); ++iter)
-            iter->merge();
+        for (typename std::vector<std::unique_ptr<Record<ESXRecordT> > >::iterator iter (mRecords.begin()); iter!=mRecords.end(); ++iter)
+            (*iter)->merge();
 
         purge();
     }
@@ -430,41 +440,53 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void  Collection<ESXRecordT, IdAccessorT>::purge()
     {
-        int i = 0;
+        // Compact the remaining records in a single pass, instead of removing the erased ones one by
+        // one and renumbering all following rows each time.
+        int size = static_cast<int> (mRecords.size());
+        int kept = 0;
 
-        while (i<static_cast<int> (mRecords.size()))
+        for (int i=0; i<size; ++i)
         {
-            if (mRecords[i].isErased())
-                removeRows (i, 1);
+            if (mRecords[i]->isErased())
+            {
+                if (mRowIndex[i])
+                {
+                    std::string id = mRowIndex[i]->first;
+                    mIndex.erase (id);
+                }
+            }
             else
-                ++i;
+            {
+                if (kept!=i)
+                {
+                    mRecords[kept] = std::move (mRecords[i]);
+                    mRowIndex[kept] = mRowIndex[i];
+                }
+
+                ++kept;
+            }
         }
+
+        mRecords.resize (kept);
+        mRowIndex.resize (kept);
+
+        renumberRows (0, kept);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::removeRows (int index, int count)
     {
-        mRecords.erase (mRecords.begin()+index, mRecords.begin()+index+count);
-
-        typename std::map<std::string, int>::iterator iter = mIndex.begin();
-
-        while (iter!=mIndex.end())
-        {
-            if (iter->second>=index)
+        for (int i=index; i<index+count; ++i)
+            if (mRowIndex.at (i))
             {
-                if (iter->second>=index+count)
-                {
-                    iter->second -= count;
-                    ++iter;
-                }
-                else
-                {
-                    mIndex.erase (iter++);
-                }
+                std::string id = mRowIndex[i]->first;
+                mIndex.erase (id);
             }
-            else
-                ++iter;
-        }
+
+        mRecords.erase (mRecords.begin()+index, mRecords.begin()+index+count);
+        mRowIndex.erase (mRowIndex.begin()+index, mRowIndex.begin()+index+count);
+
+        renumberRows (index, static_cast<int> (mRecords.size()));
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -485,9 +507,7 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     int Collection<ESXRecordT, IdAccessorT>::searchId (const std::string& id) const
     {
-        std::string id2 = Misc::StringUtils::lowerCase(id);
-
-        std::map<std::string, int>::const_iterator iter = mIndex.find (id2);
+        typename IdIndex::const_iterator iter = mIndex.find (id);
 
         if (iter==mIndex.end())
             return -1;
@@ -498,7 +518,7 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::replace (int index, const RecordBase& record)
     {
-        mRecords.at (index) = dynamic_cast<const Record<ESXRecordT>&> (record);
+        *mRecords.at (index) = dynamic_cast<const Record<ESXRecordT>&> (record);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -520,15 +540,28 @@ namespace CSMWorld
     template<typename ESXRecordT, typename IdAccessorT>
     std::vector<std::string> Collection<ESXRecordT, IdAccessorT>::getIds (bool listDeleted) const
     {
-        std::vector<std::string> ids;
+        // Sort by the lower case keys of the index, like the IDs have always been listed
+        std::vector<const typename IdIndex::value_type *> entries;
+        entries.reserve (mIndex.size());
 
-        for (typename std::map<std::string, int>::const_iterator iter = mIndex.begin();
-            iter!=mIndex.end(); ++iter)
+        for (typename IdIndex::const_iterator iter = mIndex.begin(); iter!=mIndex.end(); ++iter)
         {
-            if (listDeleted || !mRecords[iter->second].isDeleted())
-                ids.push_back (IdAccessorT().getId (mRecords[iter->second].get()));
+            if (listDeleted || !mRecords[iter->second]->isDeleted())
+                entries.push_back (&*iter);
         }
 
+        std::sort (entries.begin(), entries.end(),
+            [] (const typename IdIndex::value_type *left, const typename IdIndex::value_type *right)
+            {
+                return left->first < right->first;
+            });
+
+        std::vector<std::string> ids;
+        ids.reserve (entries.size());
+
+        for (const typename IdIndex::value_type *entry : entries)
+            ids.push_back (IdAccessorT().getId (mRecords[entry->second]->get()));
+
         return ids;
     }
 
@@ -536,13 +569,13 @@ namespace CSMWorld
     const Record<ESXRecordT>& Collection<ESXRecordT, IdAccessorT>::getRecord (const std::string& id) const
     {
         int index = getIndex (id);
-        return mRecords.at (index);
+        return *mRecords.at (index);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
     const Record<ESXRecordT>& Collection<ESXRecordT, IdAccessorT>::getRecord (int index) const
     {
-        return mRecords.at (index);
+        return *mRecords.at (index);
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -554,28 +587,26 @@ namespace CSMWorld
 
         const Record<ESXRecordT>& record2 = dynamic_cast<const Record<ESXRecordT>&> (record);
 
-        mRecords.insert (mRecords.begin()+index, record2);
+        mRecords.insert (mRecords.begin()+index, std::make_unique<Record<ESXRecordT> > (record2));
 
-        if (index<static_cast<int> (mRecords.size())-1)
-        {
-            for (std::map<std::string, int>::iterator iter (mIndex.begin()); iter!=mIndex.end();
-                ++iter)
-                 if (iter->second>=index)
-                     ++(iter->second);
-        }
+        // An ID that is already present keeps pointing to its original row
+        std::pair<typename IdIndex::iterator, bool> inserted = mIndex.insert (std::make_pair (
+            Misc::StringUtils::lowerCase (IdAccessorT().getId (record2.get())), index));
 
-        mIndex.insert (std::make_pair (Misc::StringUtils::lowerCase (IdAccessorT().getId (
-            record2.get())), index));
+        mRowIndex.insert (mRowIndex.begin()+index, inserted.second ? &*inserted.first : nullptr);
+
+        if (index<static_cast<int> (mRecords.size())-1)
+            renumberRows (index+1, static_cast<int> (mRecords.size()));
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
     void Collection<ESXRecordT, IdAccessorT>::setRecord (int index, const Record<ESXRecordT>& record)
     {
-        if (Misc::StringUtils::lowerCase (IdAccessorT().getId (mRecords.at (index).get()))!=
-            Misc::StringUtils::lowerCase (IdAccessorT().getId (record.get())))
+        if (!Misc::StringUtils::ciEqual (IdAccessorT().getId (mRecords.at (index)->get()),
+            IdAccessorT().getId (record.get())))
             throw std::runtime_error ("attempt to change the ID of a record");
 
-        mRecords.at (index) = record;
+        *mRecords.at (index) = record;
     }
 
     template<typename ESXRecordT, typename IdAccessorT>
@@ -2,6 +2,7 @@
 
 #include <stdexcept>
 #include <iterator>
+#include <algorithm>
 
 #include <components/esm/esmreader.hpp>
 #include <components/esm/loaddial.hpp>
@@ -38,7 +39,7 @@ void CSMWorld::InfoCollection::load (const Info& record, bool base)
         {
             Range range = getTopicRange (topic);
 
-            index = std::distance (getRecords().begin(), range.second);
+            index = std::distance (getRecordsBegin(), range.second);
         }
 
         insertRecord (record2, index);
@@ -65,7 +66,7 @@ int CSMWorld::InfoCollection::getInfoIndex (const std::string& id, const std::st
 
     for (; range.first!=range.second; ++range.first)
         if (Misc::StringUtils::ciEqual(range.first->get().mId, fullId))
-            return std::distance (getRecords().begin(), range.first);
+            return std::distance (getRecordsBegin(), range.first);
 
     return -1;
 }
@@ -82,7 +83,7 @@ int CSMWorld::InfoCollection::getAppendIndex (const std::string& id, UniversalId
     if (range.first==range.second)
         return Collection<Info, IdAccessor<Info> >::getAppendIndex (id, type);
 
-    return std::distance (getRecords().begin(), range.second);
+    return std::distance (getRecordsBegin(), range.second);
 }
 
 bool CSMWorld::InfoCollection::reorderRows (int baseIndex, const std::vector<int>& newOrder)
@@ -144,14 +145,20 @@ CSMWorld::InfoCollection::Range CSMWorld::InfoCollection::getTopicRange (const s
 {
     std::string topic2 = Misc::StringUtils::lowerCase (topic);
 
-    std::map<std::string, int>::const_iterator iter = getIdMap().lower_bound (topic2);
+    std::set<std::string>::const_iterator iter = mInfoIds.lower_bound (topic2);
+    int index = -1;
 
     // Skip invalid records: The beginning of a topic string could be identical to another topic
     // string.
-    for (; iter!=getIdMap().end(); ++iter)
+    for (; iter!=mInfoIds.end(); ++iter)
     {
+        index = searchId (*iter);
+
+        if (index==-1)
+            continue;
+
         std::string testTopicId =
-            Misc::StringUtils::lowerCase (getRecord (iter->second).get().mTopicId);
+            Misc::StringUtils::lowerCase (getRecord (index).get().mTopicId);
 
         if (testTopicId==topic2)
             break;
@@ -159,15 +166,15 @@ CSMWorld::InfoCollection::Range CSMWorld::InfoCollection::getTopicRange (const s
         std::size_t size = topic2.size();
 
         if (testTopicId.size()<size || testTopicId.substr (0, size)!=topic2)
-            return Range (getRecords().end(), getRecords().end());
+            return Range (getRecordsEnd(), getRecordsEnd());
     }
 
-    if (iter==getIdMap().end())
-        return Range (getRecords().end(), getRecords().end());
+    if (iter==mInfoIds.end())
+        return Range (getRecordsEnd(), getRecordsEnd());
 
-    RecordConstIterator begin = getRecords().begin()+iter->second;
+    RecordConstIterator begin = getRecordsBegin()+index;
 
-    while (begin != getRecords().begin())
+    while (begin != getRecordsBegin())
     {
         if (!Misc::StringUtils::ciEqual(begin->get().mTopicId, topic2))
         {
@@ -181,7 +188,7 @@ CSMWorld::InfoCollection::Range CSMWorld::InfoCollection::getTopicRange (const s
     // Find end
     RecordConstIterator end = begin;
 
-    for (; end!=getRecords().end(); ++end)
+    for (; end!=getRecordsEnd(); ++end)
         if (!Misc::StringUtils::ciEqual(end->get().mTopicId, topic2))
             break;
 
@@ -193,22 +200,27 @@ void CSMWorld::InfoCollection::removeDialogueInfos(const std::string& dialogueId
     std::string id = Misc::StringUtils::lowerCase(dialogueId);
     std::vector<int> erasedRecords;
 
-    std::map<std::string, int>::const_iterator current = getIdMap().lower_bound(id);
-    std::map<std::string, int>::const_iterator end = getIdMap().end();
+    std::set<std::string>::const_iterator current = mInfoIds.lower_bound(id);
+    std::set<std::string>::const_iterator end = mInfoIds.end();
     for (; current != end; ++current)
     {
-        Record<Info> record = getRecord(current->second);
+        int index = searchId(*current);
+
+        if (index == -1)
+            continue;
+
+        Record<Info> record = getRecord(index);
 
         if (Misc::StringUtils::ciEqual(dialogueId, record.get().mTopicId))
         {
             if (record.mState == RecordBase::State_ModifiedOnly)
             {
-                erasedRecords.push_back(current->second);
+                erasedRecords.push_back(index);
             }
             else
             {
                 record.mState = RecordBase::State_Deleted;
-                setRecord(current->second, record);
+                setRecord(index, record);
             }
         }
         else
@@ -217,9 +229,62 @@ void CSMWorld::InfoCollection::removeDialogueInfos(const std::string& dialogueId
         }
     }
 
+    // Remove from the back, so that the remaining indices stay valid
+    std::sort(erasedRecords.begin(), erasedRecords.end());
+
     while (!erasedRecords.empty())
     {
         removeRows(erasedRecords.back(), 1);
         erasedRecords.pop_back();
     }
 }
+
+CSMWorld::InfoCollection::RecordConstIterator CSMWorld::InfoCollection::getRecordsBegin() const
+{
+    return RecordConstIterator (getRecords().begin());
+}
+
+CSMWorld::InfoCollection::RecordConstIterator CSMWorld::InfoCollection::getRecordsEnd() const
+{
+    return RecordConstIterator (getRecords().end());
+}
+
+void CSMWorld::InfoCollection::eraseInfoIds (const std::vector<std::string>& ids)
+{
+    for (const std::string& id : ids)
+        if (searchId (id)==-1)
+            mInfoIds.erase (Misc::StringUtils::lowerCase (id));
+}
+
+void CSMWorld::InfoCollection::purge()
+{
+    Collection<Info, IdAccessor<Info> >::purge();
+
+    // The IDs of erased records can not be accessed anymore, so rebuild the ordered IDs instead
+    mInfoIds.clear();
+
+    for (int i=0; i<getSize(); ++i)
+        mInfoIds.insert (Misc::StringUtils::lowerCase (getRecord (i).get().mId));
+}
+
+void CSMWorld::InfoCollection::removeRows (int index, int count)
+{
+    std::vector<std::string> ids;
+
+    for (int i=index; i<index+count; ++i)
+        if (!getRecord (i).isErased())
+            ids.push_back (getRecord (i).get().mId);
+
+    Collection<Info, IdAccessor<Info> >::removeRows (index, count);
+
+    eraseInfoIds (ids);
+}
+
+void CSMWorld::InfoCollection::insertRecord (const RecordBase& record, int index,
+    UniversalId::Type type)
+{
+    Collection<Info, IdAccessor<Info> >::insertRecord (record, index, type);
+
+    mInfoIds.insert (Misc::StringUtils::lowerCase (
+        dynamic_cast<const Record<Info>&> (record).get().mId));
+}
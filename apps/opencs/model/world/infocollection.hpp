@@ -1,6 +1,10 @@
 #ifndef CSM_WOLRD_INFOCOLLECTION_H
 #define CSM_WOLRD_INFOCOLLECTION_H
 
+#include <set>
+
+#include <boost/iterator/indirect_iterator.hpp>
+
 #include "collection.hpp"
 #include "info.hpp"
 
@@ -15,13 +19,25 @@ namespace CSMWorld
     {
         public:
 
-            typedef std::vector<Record<Info> >::const_iterator RecordConstIterator;
+            typedef boost::indirect_iterator<std::vector<std::unique_ptr<Record<Info> > >::const_iterator>
+                RecordConstIterator;
             typedef std::pair<RecordConstIterator, RecordConstIterator> Range;
 
         private:
 
+            std::set<std::string> mInfoIds;
+            ///< Lower case IDs of all infos. Ordered, so that the infos of a topic can be found by
+            /// their "topic#" prefix.
+
             void load (const Info& record, bool base);
 
+            RecordConstIterator getRecordsBegin() const;
+
+            RecordConstIterator getRecordsEnd() const;
+
+            void eraseInfoIds (const std::vector<std::string>& ids);
+            ///< Remove \a ids from mInfoIds, unless another record with the same ID is still present.
+
             int getInfoIndex (const std::string& id, const std::string& topic) const;
             ///< Return index for record \a id or -1 (if not present; deleted records are considered)
             ///
@@ -39,6 +55,13 @@ namespace CSMWorld
             ///
             /// \return Success?
 
+            void purge() override;
+
+            void removeRows (int index, int count) override;
+
+            void insertRecord (const RecordBase& record, int index,
+                UniversalId::Type type = UniversalId::Type_None) override;
+
             void load (ESM::ESMReader& reader, bool base, const ESM::Dialogue& dialogue);
 
             Range getTopicRange (const std::string& topic) const;
@@ -70,6 +70,7 @@ namespace MWMechanics
 namespace DetourNavigator
 {
     struct Navigator;
+    class AsyncPathFinder;
 }
 
 namespace MWWorld
@@ -631,6 +632,9 @@ namespace MWBase
 
             virtual DetourNavigator::Navigator* getNavigator() const = 0;
 
+            /// @return nullptr if paths have to be found in the main thread
+            virtual DetourNavigator::AsyncPathFinder* getAsyncPathFinder() const = 0;
+
             virtual void updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
                     const osg::Vec3f& halfExtents, const osg::Vec3f& start, const osg::Vec3f& end) const = 0;
 
@@ -119,7 +119,7 @@ namespace MWClass
     {
         std::shared_ptr<Class> instance (new Light);
 
-        registerClass (typeid (ESM::Light).name(), instance);
+        registerClass<ESM::Light> (instance);
     }
 
     std::string Light::getUpSoundId (const MWWorld::ConstPtr& ptr) const
@@ -85,7 +85,7 @@ namespace MWClass
     {
         std::shared_ptr<Class> instance (new Lockpick);
 
-        registerClass (typeid (ESM::Lockpick).name(), instance);
+        registerClass<ESM::Lockpick> (instance);
     }
 
     std::string Lockpick::getUpSoundId (const MWWorld::ConstPtr& ptr) const
@@ -79,7 +79,7 @@ namespace MWClass
     {
         std::shared_ptr<Class> instance (new Potion);
 
-        registerClass (typeid (ESM::Potion).name(), instance);
+        registerClass<ESM::Potion> (instance);
     }
 
     std::string Potion::getUpSoundId (const MWWorld::ConstPtr& ptr) const
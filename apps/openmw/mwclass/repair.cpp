@@ -74,7 +74,7 @@ namespace MWClass
     {
         std::shared_ptr<Class> instance (new Repair);
 
-        registerClass (typeid (ESM::Repair).name(), instance);
+        registerClass<ESM::Repair> (instance);
     }
 
     std::string Repair::getUpSoundId (const MWWorld::ConstPtr& ptr) const
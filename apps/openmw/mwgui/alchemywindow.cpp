@@ -194,7 +194,7 @@ namespace MWGui
         for (size_t i = 0; i < mModel->getItemCount(); ++i)
         {
             MWWorld::Ptr item = mModel->getItem(i).mBase;
-            if (item.getTypeName() != typeid(ESM::Ingredient).name())
+            if (item.getType() != MWWorld::RefType::Ingredient)
                 continue;
 
             itemNames.insert(item.getClass().getName(item));
@@ -209,7 +209,7 @@ bool ContainerItemModel::onDropItem(const MWWorld::Ptr &item, int count)
 
     MWWorld::Ptr target = mItemSources[0].first;
 
-    if (target.getTypeName() != typeid(ESM::Container).name())
+    if (target.getType() != MWWorld::RefType::Container)
         return true;
 
     // check container organic flag
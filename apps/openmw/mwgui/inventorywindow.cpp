@@ -45,7 +45,7 @@ namespace
 
     bool isRightHandWeapon(const MWWorld::Ptr& item)
     {
-        if (item.getClass().getTypeName() != typeid(ESM::Weapon).name())
+        if (item.getClass().getType() != MWWorld::RefType::Weapon)
             return false;
         std::vector<int> equipmentSlots = item.getClass().getEquipmentSlots(item).first;
         return (!equipmentSlots.empty() && equipmentSlots.front() == MWWorld::InventoryStore::Slot_CarriedRight);
@@ -285,7 +285,7 @@ namespace MWGui
         // If we unequip weapon during attack, it can lead to unexpected behaviour
         if (MWBase::Environment::get().getMechanicsManager()->isAttackingOrSpell(mPtr))
         {
-            bool isWeapon = item.mBase.getTypeName() == typeid(ESM::Weapon).name();
+            bool isWeapon = item.mBase.getType() == MWWorld::RefType::Weapon;
             MWWorld::InventoryStore& invStore = mPtr.getClass().getInventoryStore(mPtr);
 
             if (isWeapon && invStore.isEquipped(item.mBase))
@@ -562,9 +562,9 @@ namespace MWGui
         if (!script.empty())
         {
             // Ingredients, books and repair hammers must not have OnPCEquip set to 1 here
-            const std::string& type = ptr.getTypeName();
-            bool isBook = type == typeid(ESM::Book).name();
-            if (!isBook && type != typeid(ESM::Ingredient).name() && type != typeid(ESM::Repair).name())
+            MWWorld::RefType type = ptr.getType();
+            bool isBook = type == MWWorld::RefType::Book;
+            if (!isBook && type != MWWorld::RefType::Ingredient && type != MWWorld::RefType::Repair)
                 ptr.getRefData().getLocals().setVarByInt(script, "onpcequip", 1);
             // Books must have PCSkipEquip set to 1 instead
             else if (isBook)
@@ -600,8 +600,8 @@ namespace MWGui
             useItem(ptr);
 
             // If item is ingredient or potion don't stop drag and drop to simplify action of taking more than one 1 item
-            if ((ptr.getTypeName() == typeid(ESM::Potion).name() ||
-                 ptr.getTypeName() == typeid(ESM::Ingredient).name())
+            if ((ptr.getType() == MWWorld::RefType::Potion ||
+                 ptr.getType() == MWWorld::RefType::Ingredient)
                 && mDragAndDrop->mDraggedCount > 1)
             {
                 // Item can be provided from other window for example container.
@@ -717,19 +717,19 @@ namespace MWGui
         if (!MWBase::Environment::get().getWindowManager()->isAllowed(GW_Inventory))
             return;
         // make sure the object is of a type that can be picked up
-        std::string type = object.getTypeName();
-        if ( (type != typeid(ESM::Apparatus).name())
-            && (type != typeid(ESM::Armor).name())
-            && (type != typeid(ESM::Book).name())
-            && (type != typeid(ESM::Clothing).name())
-            && (type != typeid(ESM::Ingredient).name())
-            && (type != typeid(ESM::Light).name())
-            && (type != typeid(ESM::Miscellaneous).name())
-            && (type != typeid(ESM::Lockpick).name())
-            && (type != typeid(ESM::Probe).name())
-            && (type != typeid(ESM::Repair).name())
-            && (type != typeid(ESM::Weapon).name())
-            && (type != typeid(ESM::Potion).name()))
+        MWWorld::RefType type = object.getType();
+        if ( (type != MWWorld::RefType::Apparatus)
+            && (type != MWWorld::RefType::Armor)
+            && (type != MWWorld::RefType::Book)
+            && (type != MWWorld::RefType::Clothing)
+            && (type != MWWorld::RefType::Ingredient)
+            && (type != MWWorld::RefType::Light)
+            && (type != MWWorld::RefType::Miscellaneous)
+            && (type != MWWorld::RefType::Lockpick)
+            && (type != MWWorld::RefType::Probe)
+            && (type != MWWorld::RefType::Repair)
+            && (type != MWWorld::RefType::Weapon)
+            && (type != MWWorld::RefType::Potion))
             return;
 
         // An object that can be picked up must have a tooltip.
@@ -816,7 +816,7 @@ namespace MWGui
 
             lastId = item.getCellRef().getRefId();
 
-            if (item.getClass().getTypeName() == typeid(ESM::Weapon).name() &&
+            if (item.getClass().getType() == MWWorld::RefType::Weapon &&
                 isRightHandWeapon(item) &&
                 item.getClass().canBeEquipped(item, player).first)
             {
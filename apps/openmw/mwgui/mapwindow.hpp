@@ -32,11 +32,6 @@ namespace Loading
     class Listener;
 }
 
-namespace SceneUtil
-{
-    class WorkQueue;
-}
-
 namespace MWGui
 {
 
@@ -205,7 +200,7 @@ namespace MWGui
     class MapWindow : public MWGui::WindowPinnableBase, public LocalMapBase, public NoDrop
     {
     public:
-        MapWindow(CustomMarkerCollection& customMarkers, DragAndDrop* drag, MWRender::LocalMap* localMapRender, SceneUtil::WorkQueue* workQueue);
+        MapWindow(CustomMarkerCollection& customMarkers, DragAndDrop* drag, MWRender::LocalMap* localMapRender);
         virtual ~MapWindow();
 
         void setCellName(const std::string& cellName);
@@ -387,9 +387,9 @@ namespace MWGui
 
             if (key->type == Type_Item)
             {
-                bool isWeapon = item.getTypeName() == typeid(ESM::Weapon).name();
-                bool isTool = item.getTypeName() == typeid(ESM::Probe).name() ||
-                    item.getTypeName() == typeid(ESM::Lockpick).name();
+                bool isWeapon = item.getType() == MWWorld::RefType::Weapon;
+                bool isTool = item.getType() == MWWorld::RefType::Probe ||
+                    item.getType() == MWWorld::RefType::Lockpick;
 
                 // delay weapon switching if player is busy
                 if (isDelayNeeded && (isWeapon || isTool))
@@ -1,5 +1,7 @@
 #include "sortfilteritemmodel.hpp"
 
+#include <array>
+
 #include <components/misc/stringops.hpp>
 #include <components/debug/debuglog.hpp>
 #include <components/esm/loadalch.hpp>
@@ -27,22 +29,23 @@
 
 namespace
 {
-    bool compareType(const std::string& type1, const std::string& type2)
+    bool compareType(MWWorld::RefType type1, MWWorld::RefType type2)
     {
-        // this defines the sorting order of types. types that are first in the vector appear before other types.
-        std::vector<std::string> mapping;
-        mapping.push_back( typeid(ESM::Weapon).name() );
-        mapping.push_back( typeid(ESM::Armor).name() );
-        mapping.push_back( typeid(ESM::Clothing).name() );
-        mapping.push_back( typeid(ESM::Potion).name() );
-        mapping.push_back( typeid(ESM::Ingredient).name() );
-        mapping.push_back( typeid(ESM::Apparatus).name() );
-        mapping.push_back( typeid(ESM::Book).name() );
-        mapping.push_back( typeid(ESM::Light).name() );
-        mapping.push_back( typeid(ESM::Miscellaneous).name() );
-        mapping.push_back( typeid(ESM::Lockpick).name() );
-        mapping.push_back( typeid(ESM::Repair).name() );
-        mapping.push_back( typeid(ESM::Probe).name() );
+        // this defines the sorting order of types. types that are first in the array appear before other types.
+        static const std::array<MWWorld::RefType, 12> mapping = {
+            MWWorld::RefType::Weapon,
+            MWWorld::RefType::Armor,
+            MWWorld::RefType::Clothing,
+            MWWorld::RefType::Potion,
+            MWWorld::RefType::Ingredient,
+            MWWorld::RefType::Apparatus,
+            MWWorld::RefType::Book,
+            MWWorld::RefType::Light,
+            MWWorld::RefType::Miscellaneous,
+            MWWorld::RefType::Lockpick,
+            MWWorld::RefType::Repair,
+            MWWorld::RefType::Probe
+        };
 
         assert( std::find(mapping.begin(), mapping.end(), type1) != mapping.end() );
         assert( std::find(mapping.begin(), mapping.end(), type2) != mapping.end() );
@@ -62,15 +65,15 @@ namespace
             float result = 0;
 
             // compare items by type
-            std::string leftName = left.mBase.getTypeName();
-            std::string rightName = right.mBase.getTypeName();
+            MWWorld::RefType leftType = left.mBase.getType();
+            MWWorld::RefType rightType = right.mBase.getType();
 
-            if (leftName != rightName)
-                return compareType(leftName, rightName);
+            if (leftType != rightType)
+                return compareType(leftType, rightType);
 
             // compare items by name
-            leftName = Misc::StringUtils::lowerCaseUtf8(left.mBase.getClass().getName(left.mBase));
-            rightName = Misc::StringUtils::lowerCaseUtf8(right.mBase.getClass().getName(right.mBase));
+            std::string leftName = Misc::StringUtils::lowerCaseUtf8(left.mBase.getClass().getName(left.mBase));
+            std::string rightName = Misc::StringUtils::lowerCaseUtf8(right.mBase.getClass().getName(right.mBase));
 
             result = leftName.compare(rightName);
             if (result != 0)
@@ -179,22 +182,22 @@ namespace MWGui
         MWWorld::Ptr base = item.mBase;
 
         int category = 0;
-        if (base.getTypeName() == typeid(ESM::Armor).name()
-                || base.getTypeName() == typeid(ESM::Clothing).name())
+        if (base.getType() == MWWorld::RefType::Armor
+                || base.getType() == MWWorld::RefType::Clothing)
             category = Category_Apparel;
-        else if (base.getTypeName() == typeid(ESM::Weapon).name())
+        else if (base.getType() == MWWorld::RefType::Weapon)
             category = Category_Weapon;
-        else if (base.getTypeName() == typeid(ESM::Ingredient).name()
-                     || base.getTypeName() == typeid(ESM::Potion).name())
+        else if (base.getType() == MWWorld::RefType::Ingredient
+                     || base.getType() == MWWorld::RefType::Potion)
             category = Category_Magic;
-        else if (base.getTypeName() == typeid(ESM::Miscellaneous).name()
-                 || base.getTypeName() == typeid(ESM::Ingredient).name()
-                 || base.getTypeName() == typeid(ESM::Repair).name()
-                 || base.getTypeName() == typeid(ESM::Lockpick).name()
-                 || base.getTypeName() == typeid(ESM::Light).name()
-                 || base.getTypeName() == typeid(ESM::Apparatus).name()
-                 || base.getTypeName() == typeid(ESM::Book).name()
-                 || base.getTypeName() == typeid(ESM::Probe).name())
+        else if (base.getType() == MWWorld::RefType::Miscellaneous
+                 || base.getType() == MWWorld::RefType::Ingredient
+                 || base.getType() == MWWorld::RefType::Repair
+                 || base.getType() == MWWorld::RefType::Lockpick
+                 || base.getType() == MWWorld::RefType::Light
+                 || base.getType() == MWWorld::RefType::Apparatus
+                 || base.getType() == MWWorld::RefType::Book
+                 || base.getType() == MWWorld::RefType::Probe)
             category = Category_Misc;
 
         if (item.mFlags & ItemStack::Flag_Enchanted)
@@ -205,7 +208,7 @@ namespace MWGui
 
         if (mFilter & Filter_OnlyIngredients)
         {
-            if (base.getTypeName() != typeid(ESM::Ingredient).name())
+            if (base.getType() != MWWorld::RefType::Ingredient)
                 return false;
 
             if (!mNameFilter.empty() && !mEffectFilter.empty())
@@ -238,18 +241,18 @@ namespace MWGui
 
         if ((mFilter & Filter_OnlyEnchanted) && !(item.mFlags & ItemStack::Flag_Enchanted))
             return false;
-        if ((mFilter & Filter_OnlyChargedSoulstones) && (base.getTypeName() != typeid(ESM::Miscellaneous).name()
+        if ((mFilter & Filter_OnlyChargedSoulstones) && (base.getType() != MWWorld::RefType::Miscellaneous
                                                      || base.getCellRef().getSoul() == "" || !MWBase::Environment::get().getWorld()->getStore().get<ESM::Creature>().search(base.getCellRef().getSoul())))
             return false;
-        if ((mFilter & Filter_OnlyRepairTools) && (base.getTypeName() != typeid(ESM::Repair).name()))
+        if ((mFilter & Filter_OnlyRepairTools) && (base.getType() != MWWorld::RefType::Repair))
             return false;
         if ((mFilter & Filter_OnlyEnchantable) && (item.mFlags & ItemStack::Flag_Enchanted
-                                               || (base.getTypeName() != typeid(ESM::Armor).name()
-                                                   && base.getTypeName() != typeid(ESM::Clothing).name()
-                                                   && base.getTypeName() != typeid(ESM::Weapon).name()
-                                                   && base.getTypeName() != typeid(ESM::Book).name())))
+                                               || (base.getType() != MWWorld::RefType::Armor
+                                                   && base.getType() != MWWorld::RefType::Clothing
+                                                   && base.getType() != MWWorld::RefType::Weapon
+                                                   && base.getType() != MWWorld::RefType::Book)))
             return false;
-        if ((mFilter & Filter_OnlyEnchantable) && base.getTypeName() == typeid(ESM::Book).name()
+        if ((mFilter & Filter_OnlyEnchantable) && base.getType() == MWWorld::RefType::Book
                 && !base.get<ESM::Book>()->mBase->mData.mIsScroll)
             return false;
 
@@ -263,8 +266,8 @@ namespace MWGui
         if ((mFilter & Filter_OnlyRepairable) && (
                     !base.getClass().hasItemHealth(base)
                     || (base.getClass().getItemHealth(base) == base.getClass().getItemMaxHealth(base))
-                    || (base.getTypeName() != typeid(ESM::Weapon).name()
-                        && base.getTypeName() != typeid(ESM::Armor).name())))
+                    || (base.getType() != MWWorld::RefType::Weapon
+                        && base.getType() != MWWorld::RefType::Armor)))
             return false;
 
         if (mFilter & Filter_OnlyRechargable)
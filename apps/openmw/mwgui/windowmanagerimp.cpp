@@ -36,7 +36,6 @@
 #include <components/resource/resourcesystem.hpp>
 #include <components/resource/imagemanager.hpp>
 
-#include <components/sceneutil/workqueue.hpp>
 
 #include <components/translation/translation.hpp>
 
@@ -122,14 +121,13 @@
 namespace MWGui
 {
     WindowManager::WindowManager(
-            SDL_Window* window, osgViewer::Viewer* viewer, osg::Group* guiRoot, Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
+            SDL_Window* window, osgViewer::Viewer* viewer, osg::Group* guiRoot, Resource::ResourceSystem* resourceSystem,
             const std::string& logpath, const std::string& resourcePath, bool consoleOnlyScripts, Translation::Storage& translationDataStorage,
             ToUTF8::FromType encoding, bool exportFonts, const std::string& versionDescription, const std::string& userDataPath)
       : mOldUpdateMask(0)
       , mOldCullMask(0)
       , mStore(nullptr)
       , mResourceSystem(resourceSystem)
-      , mWorkQueue(workQueue)
       , mViewer(viewer)
       , mConsoleOnlyScripts(consoleOnlyScripts)
       , mCurrentModals()
@@ -302,7 +300,7 @@ namespace MWGui
         mWindows.push_back(menu);
 
         mLocalMapRender = new MWRender::LocalMap(mViewer->getSceneData()->asGroup());
-        mMap = new MapWindow(mCustomMarkers, mDragAndDrop, mLocalMapRender, mWorkQueue);
+        mMap = new MapWindow(mCustomMarkers, mDragAndDrop, mLocalMapRender);
         mWindows.push_back(mMap);
         mMap->renderGlobalMap();
         trackWindow(mMap, "map");
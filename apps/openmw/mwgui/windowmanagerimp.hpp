@@ -62,11 +62,6 @@ namespace Resource
     class ResourceSystem;
 }
 
-namespace SceneUtil
-{
-    class WorkQueue;
-}
-
 namespace SDLUtil
 {
     class SDLCursorManager;
@@ -132,7 +127,7 @@ namespace MWGui
     typedef std::pair<std::string, int> Faction;
     typedef std::vector<Faction> FactionList;
 
-    WindowManager(SDL_Window* window, osgViewer::Viewer* viewer, osg::Group* guiRoot, Resource::ResourceSystem* resourceSystem, SceneUtil::WorkQueue* workQueue,
+    WindowManager(SDL_Window* window, osgViewer::Viewer* viewer, osg::Group* guiRoot, Resource::ResourceSystem* resourceSystem,
                   const std::string& logpath, const std::string& cacheDir, bool consoleOnlyScripts, Translation::Storage& translationDataStorage,
                   ToUTF8::FromType encoding, bool exportFonts, const std::string& versionDescription, const std::string& localPath);
     virtual ~WindowManager();
@@ -387,7 +382,6 @@ namespace MWGui
 
     const MWWorld::ESMStore* mStore;
     Resource::ResourceSystem* mResourceSystem;
-    osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
 
     osgMyGUI::Platform* mGuiPlatform;
     osgViewer::Viewer* mViewer;
@@ -73,6 +73,7 @@ namespace MWMechanics
     void ActiveSpells::rebuildEffects() const
     {
         mEffects = MagicEffects();
+        ++mEffectsRevision;
 
         for (TIterator iter (begin()); iter!=end(); ++iter)
         {
@@ -88,6 +89,7 @@ namespace MWMechanics
 
     ActiveSpells::ActiveSpells()
         : mSpellsChanged (false)
+        , mEffectsRevision (0)
     {}
 
     const MagicEffects& ActiveSpells::getMagicEffects() const
@@ -96,6 +98,12 @@ namespace MWMechanics
         return mEffects;
     }
 
+    unsigned int ActiveSpells::getEffectsRevision() const
+    {
+        update(0.f);
+        return mEffectsRevision;
+    }
+
     ActiveSpells::TIterator ActiveSpells::begin() const
     {
         return mSpells.begin();
@@ -51,6 +51,7 @@ namespace MWMechanics
             mutable TContainer mSpells;
             mutable MagicEffects mEffects;
             mutable bool mSpellsChanged;
+            mutable unsigned int mEffectsRevision;
 
             void rebuildEffects() const;
 
@@ -103,6 +104,9 @@ namespace MWMechanics
 
             const MagicEffects& getMagicEffects() const;
 
+            unsigned int getEffectsRevision() const;
+            ///< Return a number that changes whenever the result of getMagicEffects() changes.
+
             void visitEffectSources (MWMechanics::EffectSourceVisitor& visitor) const;
 
     };
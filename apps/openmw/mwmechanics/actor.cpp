@@ -58,4 +58,14 @@ namespace MWMechanics
     {
         mIsTurningToPlayer = turning;
     }
+
+    std::size_t Actor::getIndex() const
+    {
+        return mIndex;
+    }
+
+    void Actor::setIndex(std::size_t index)
+    {
+        mIndex = index;
+    }
 }
@@ -1,6 +1,7 @@
 #ifndef OPENMW_MECHANICS_ACTOR_H
 #define OPENMW_MECHANICS_ACTOR_H
 
+#include <cstddef>
 #include <memory>
 
 #include "../mwmechanics/actorutil.hpp"
@@ -41,12 +42,17 @@ namespace MWMechanics
         bool isTurningToPlayer() const;
         void setTurningToPlayer(bool turning);
 
+        /// Position of this actor in the actor arrays of Actors
+        std::size_t getIndex() const;
+        void setIndex(std::size_t index);
+
     private:
         std::unique_ptr<CharacterController> mCharacterController;
         int mGreetingTimer{0};
         float mTargetAngleRadians{0.f};
         GreetingState mGreetingState{Greet_None};
         bool mIsTurningToPlayer{false};
+        std::size_t mIndex{0};
     };
 
 }
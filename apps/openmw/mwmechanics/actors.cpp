@@ -1,13 +1,18 @@
 #include "actors.hpp"
 
+#include <exception>
+#include <functional>
+
 #include <components/esm/esmreader.hpp>
 #include <components/esm/esmwriter.hpp>
 
 #include <components/sceneutil/positionattitudetransform.hpp>
+#include <components/sceneutil/workqueue.hpp>
 #include <components/debug/debuglog.hpp>
 #include <components/misc/rng.hpp>
 #include <components/misc/mathutil.hpp>
 #include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include "../mwworld/esmstore.hpp"
 #include "../mwworld/class.hpp"
@@ -100,7 +105,7 @@ public:
                         float magnitude, float remainingTime = -1, float totalTime = -1) override
     {
         if (((key.mId == ESM::MagicEffect::CommandHumanoid && mActor.getClass().isNpc())
-            || (key.mId == ESM::MagicEffect::CommandCreature && mActor.getTypeName() == typeid(ESM::Creature).name()))
+            || (key.mId == ESM::MagicEffect::CommandCreature && mActor.getType() == MWWorld::RefType::Creature))
             && magnitude >= mActor.getClass().getCreatureStats(mActor).getLevel())
                 mCommanded = true;
     }
@@ -142,6 +147,35 @@ void getRestorationPerHourOfSleep (const MWWorld::Ptr& ptr, float& health, float
     magicka = fRestMagicMult * stats.getAttribute(ESM::Attribute::Intelligence).getModified();
 }
 
+/// Rates a share of the combat targets for Actors::rateCombatTargets() on a worker thread.
+class RateCombatTargetsWorkItem : public SceneUtil::WorkItem
+{
+public:
+    RateCombatTargetsWorkItem(std::function<void()>&& rate)
+        : mRate(std::move(rate))
+    {
+    }
+
+    void doWork() override
+    {
+        try
+        {
+            mRate();
+        }
+        catch (...)
+        {
+            mException = std::current_exception();
+        }
+    }
+
+    /// Valid after waitTillDone()
+    std::exception_ptr getException() const { return mException; }
+
+private:
+    std::function<void()> mRate;
+    std::exception_ptr mException;
+};
+
 }
 
 namespace MWMechanics
@@ -355,8 +389,8 @@ namespace MWMechanics
             if (!wasEquipped)
                 return;
 
-            std::string type = currentItem->getTypeName();
-            if (type != typeid(ESM::Weapon).name() && type != typeid(ESM::Armor).name() && type != typeid(ESM::Clothing).name())
+            MWWorld::RefType type = currentItem->getType();
+            if (type != MWWorld::RefType::Weapon && type != MWWorld::RefType::Armor && type != MWWorld::RefType::Clothing)
                 return;
 
             if (actor.getClass().getCreatureStats(actor).isDead())
@@ -684,7 +718,7 @@ namespace MWMechanics
             return;
 
         // If set in the settings file, player followers and escorters will become aggressive toward enemies in combat with them or the player
-        static const bool followersAttackOnSight = Settings::Manager::getBool("followers attack on sight", "Game");
+        static const Settings::SettingValue<bool> followersAttackOnSight("followers attack on sight", "Game");
         if (!aggressive && isPlayerFollowerOrEscorter && followersAttackOnSight)
         {
             if (actor2.getClass().getCreatureStats(actor2).getAiSequence().isInCombat(actor1))
@@ -755,17 +789,28 @@ namespace MWMechanics
         if (creatureStats.isDeathAnimationFinished())
             return;
 
-        MagicEffects now = creatureStats.getSpells().getMagicEffects();
-
+        const Spells& spells = creatureStats.getSpells();
+        const ActiveSpells& activeSpells = creatureStats.getActiveSpells();
+        const MWWorld::InventoryStore* store = nullptr;
         if (creature.getClass().hasInventoryStore(creature))
-        {
-            MWWorld::InventoryStore& store = creature.getClass().getInventoryStore (creature);
-            now += store.getMagicEffects();
-        }
+            store = &creature.getClass().getInventoryStore(creature);
 
-        now += creatureStats.getActiveSpells().getMagicEffects();
+        // Only merge the effect sources again if one of them changed since the last update
+        const unsigned int spellsRevision = spells.getEffectsRevision();
+        const unsigned int activeSpellsRevision = activeSpells.getEffectsRevision();
+        const unsigned int itemsRevision = store ? store->getMagicEffectsRevision() : 0;
+        if (creatureStats.hasMagicEffectSources(spellsRevision, activeSpellsRevision, itemsRevision))
+            return;
+
+        MagicEffects now = spells.getMagicEffects();
+
+        if (store)
+            now += store->getMagicEffects();
+
+        now += activeSpells.getMagicEffects();
 
         creatureStats.modifyMagicEffects(now);
+        creatureStats.setMagicEffectSources(spellsRevision, activeSpellsRevision, itemsRevision);
     }
 
     void Actors::calculateDynamicStats (const MWWorld::Ptr& ptr)
@@ -909,7 +954,10 @@ namespace MWMechanics
                 {
                     CreatureStats& creatureStats = mActor.getClass().getCreatureStats(mActor);
                     if (effectTick(creatureStats, mActor, key, magnitude * remainingTime))
+                    {
                         creatureStats.getMagicEffects().add(key, -magnitude);
+                        creatureStats.invalidateMagicEffectSources();
+                    }
                 }
             }
     };
@@ -1345,7 +1393,7 @@ namespace MWMechanics
             MWWorld::ContainerStoreIterator torch = inventoryStore.end();
             for (MWWorld::ContainerStoreIterator it = inventoryStore.begin(); it != inventoryStore.end(); ++it)
             {
-                if (it->getTypeName() == typeid(ESM::Light).name() &&
+                if (it->getType() == MWWorld::RefType::Light &&
                     it->getClass().canBeEquipped(*it, ptr).first)
                 {
                     torch = it;
@@ -1360,7 +1408,7 @@ namespace MWMechanics
                     if (!ptr.getClass().getCreatureStats (ptr).getAiSequence().isInCombat())
                     {
                         // For non-hostile NPCs, unequip whatever is in the left slot in favor of a light.
-                        if (heldIter != inventoryStore.end() && heldIter->getTypeName() != typeid(ESM::Light).name())
+                        if (heldIter != inventoryStore.end() && heldIter->getType() != MWWorld::RefType::Light)
                             inventoryStore.unequipItem(*heldIter, ptr);
                     }
 
@@ -1375,7 +1423,7 @@ namespace MWMechanics
             }
             else
             {
-                if (heldIter != inventoryStore.end() && heldIter->getTypeName() == typeid(ESM::Light).name())
+                if (heldIter != inventoryStore.end() && heldIter->getType() == MWWorld::RefType::Light)
                 {
                     // At day, unequip lights and auto equip shields or other suitable items
                     // (Note: autoEquip will ignore lights)
@@ -1486,10 +1534,15 @@ namespace MWMechanics
         }
     }
 
-    Actors::Actors() : mSmoothMovement(Settings::Manager::getBool("smooth movement", "Game"))
+    Actors::Actors()
+        : mCombatRatingThreads(std::max(0, Settings::Manager::getInt("combat rating threads", "Game")))
+        , mSmoothMovement(Settings::Manager::getBool("smooth movement", "Game"))
     {
         mTimerDisposeSummonsCorpses = 0.2f; // We should add a delay between summoned creature death and its corpse despawning
 
+        if (mCombatRatingThreads > 0)
+            mCombatRatingQueue = new SceneUtil::WorkQueue(mCombatRatingThreads);
+
         updateProcessingRange();
     }
 
@@ -1522,9 +1575,11 @@ namespace MWMechanics
         MWRender::Animation *anim = MWBase::Environment::get().getWorld()->getAnimation(ptr);
         if (!anim)
             return;
-        mActors.insert(std::make_pair(ptr, new Actor(ptr, anim)));
+        Actor* actor = new Actor(ptr, anim);
+        mActors.insert(std::make_pair(ptr, actor));
+        addActorEntry(ptr, actor);
 
-        CharacterController* ctrl = mActors[ptr]->getCharacterController();
+        CharacterController* ctrl = actor->getCharacterController();
         if (updateImmediately)
             ctrl->update(0);
 
@@ -1570,11 +1625,146 @@ namespace MWMechanics
         PtrActorMap::iterator iter = mActors.find(ptr);
         if(iter != mActors.end())
         {
+            removeActorEntry(iter->second);
             delete iter->second;
             mActors.erase(iter);
         }
     }
 
+    void Actors::addActorEntry(const MWWorld::Ptr& ptr, Actor* actor)
+    {
+        actor->setIndex(mActorPtrs.size());
+        mActorPtrs.push_back(ptr);
+        mActorObjects.push_back(actor);
+        mActorStats.push_back(&ptr.getClass().getCreatureStats(ptr));
+    }
+
+    void Actors::removeActorEntry(const Actor* actor)
+    {
+        const std::size_t index = actor->getIndex();
+        mActorPtrs[index] = MWWorld::Ptr();
+        mActorObjects[index] = nullptr;
+        mActorStats[index] = nullptr;
+    }
+
+    void Actors::updateActorEntries()
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < mActorObjects.size(); ++i)
+        {
+            Actor* actor = mActorObjects[i];
+            if (!actor)
+                continue;
+
+            const MWWorld::Ptr& ptr = mActorPtrs[i];
+            actor->setIndex(count);
+            mActorPtrs[count] = ptr;
+            mActorObjects[count] = actor;
+            mActorStats[count] = &ptr.getClass().getCreatureStats(ptr);
+            ++count;
+        }
+
+        mActorPtrs.resize(count);
+        mActorObjects.resize(count);
+        mActorStats.resize(count);
+    }
+
+    void Actors::rateCombatTargets(const MWWorld::Ptr& player, const osg::Vec3f& playerPos)
+    {
+        struct Job
+        {
+            std::size_t mActor;
+            std::size_t mTarget;
+        };
+        std::vector<Job> jobs;
+
+        mCombatTargetRatings.resize(mActorObjects.size());
+        for (std::size_t i = 0; i < mActorObjects.size(); ++i)
+        {
+            CombatTargetRatings& ratings = mCombatTargetRatings[i];
+            ratings.clear();
+
+            const MWWorld::Ptr& actor = mActorPtrs[i];
+            if (!mActorObjects[i] || actor == player || !isConscious(actor))
+                continue;
+
+            // Same conditions as for the AiSequence::execute() call in update()
+            if ((playerPos - actor.getRefData().getPosition().asVec3()).length2() > mActorsProcessingRange*mActorsProcessingRange)
+                continue;
+
+            for (const auto& package : mActorStats[i]->getAiSequence())
+            {
+                if (package->getTypeId() != AiPackageTypeId::Combat)
+                    break;
+
+                // getTarget() caches the target lookup, so it is called here and not by the rating threads
+                const MWWorld::Ptr target = package->getTarget();
+                if (target.isEmpty())
+                    continue;
+
+                // Stats and inventories are created on first access, make sure that happens on this thread
+                target.getClass().getCreatureStats(target);
+                if (target.getClass().hasInventoryStore(target))
+                    target.getClass().getInventoryStore(target);
+
+                jobs.push_back({i, ratings.size()});
+                ratings.emplace_back(target, 0.f);
+            }
+        }
+
+        if (jobs.empty())
+            return;
+
+        // Rating only reads the actors, their inventories and spells. Nothing else runs on the main thread
+        // until every rating is done, so the jobs can't observe a change.
+        const auto rate = [this, &jobs] (std::size_t first, std::size_t step)
+        {
+            for (std::size_t i = first; i < jobs.size(); i += step)
+            {
+                std::pair<MWWorld::Ptr, float>& rating = mCombatTargetRatings[jobs[i].mActor][jobs[i].mTarget];
+                rating.second = getBestActionRating(mActorPtrs[jobs[i].mActor], rating.first);
+            }
+        };
+
+        if (!mCombatRatingQueue || jobs.size() == 1)
+        {
+            rate(0, 1);
+            return;
+        }
+
+        // The main thread takes the first share of the jobs
+        const std::size_t numShares = std::min<std::size_t>(mCombatRatingThreads, jobs.size() - 1) + 1;
+
+        std::vector<osg::ref_ptr<RateCombatTargetsWorkItem>> workItems;
+        workItems.reserve(numShares - 1);
+        for (std::size_t share = 1; share < numShares; ++share)
+        {
+            workItems.push_back(new RateCombatTargetsWorkItem([&rate, share, numShares] { rate(share, numShares); }));
+            mCombatRatingQueue->addWorkItem(workItems.back());
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            rate(0, numShares);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // the work items refer to the jobs, so wait for all of them before reporting any failure
+        for (const auto& workItem : workItems)
+        {
+            workItem->waitTillDone();
+            if (!exception)
+                exception = workItem->getException();
+        }
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
     void Actors::castSpell(const MWWorld::Ptr& ptr, const std::string spellId, bool manualSpell)
     {
         PtrActorMap::iterator iter = mActors.find(ptr);
@@ -1624,6 +1814,10 @@ namespace MWMechanics
 
             actor->updatePtr(ptr);
             mActors.insert(std::make_pair(ptr, actor));
+
+            // The creature stats were copied to the new reference along with the rest of its data
+            mActorPtrs[actor->getIndex()] = ptr;
+            mActorStats[actor->getIndex()] = &ptr.getClass().getCreatureStats(ptr);
         }
     }
 
@@ -1634,6 +1828,7 @@ namespace MWMechanics
         {
             if((iter->first.isInCell() && iter->first.getCell()==cellStore) && iter->first != ignore)
             {
+                removeActorEntry(iter->second);
                 delete iter->second;
                 mActors.erase(iter++);
             }
@@ -1691,7 +1886,7 @@ namespace MWMechanics
         const float maxDistForPartialAvoiding = 200.f;
         const float maxDistForStrictAvoiding = 100.f;
         const float maxTimeToCheck = 2.0f;
-        static const bool giveWayWhenIdle = Settings::Manager::getBool("NPCs give way", "Game");
+        static const Settings::SettingValue<bool> giveWayWhenIdle("NPCs give way", "Game");
 
         MWWorld::Ptr player = getPlayer();
         MWBase::World* world = MWBase::Environment::get().getWorld();
@@ -1822,6 +2017,8 @@ namespace MWMechanics
 
     void Actors::update (float duration, bool paused)
     {
+        updateActorEntries();
+
         if(!paused)
         {
             static float timerUpdateAITargets = 0;
@@ -1859,13 +2056,25 @@ namespace MWMechanics
             }
             bool godmode = MWBase::Environment::get().getWorld()->getGodModeState();
 
+            // Combat targets are rated up front, in parallel, and the AI packages act on the ratings in the loop below.
+            // Actors that enter combat during the loop have their targets rated by AiSequence::execute() instead.
+            if (aiActive)
+                rateCombatTargets(player, playerPos);
+
              // AI and magic effects update
-            for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
+            // Actors may be added while iterating, so the arrays are indexed rather than iterated,
+            // and the entries are copied since the arrays may be reallocated.
+            for (std::size_t i = 0; i < mActorObjects.size(); ++i)
             {
-                bool isPlayer = iter->first == player;
-                CharacterController* ctrl = iter->second->getCharacterController();
+                Actor* actorObject = mActorObjects[i];
+                if (!actorObject)
+                    continue;
 
-                float distSqr = (playerPos - iter->first.getRefData().getPosition().asVec3()).length2();
+                const MWWorld::Ptr actor = mActorPtrs[i];
+                bool isPlayer = actor == player;
+                CharacterController* ctrl = actorObject->getCharacterController();
+
+                float distSqr = (playerPos - actor.getRefData().getPosition().asVec3()).length2();
                 // AI processing is only done within given distance to the player.
                 bool inProcessingRange = distSqr <= mActorsProcessingRange*mActorsProcessingRange;
 
@@ -1873,29 +2082,28 @@ namespace MWMechanics
                     ctrl->setAttackingOrSpell(world->getPlayer().getAttackingOrSpell());
 
                 // If dead or no longer in combat, no longer store any actors who attempted to hit us. Also remove for the player.
-                if (iter->first != player && (iter->first.getClass().getCreatureStats(iter->first).isDead()
-                    || !iter->first.getClass().getCreatureStats(iter->first).getAiSequence().isInCombat()
+                if (!isPlayer && (mActorStats[i]->isDead()
+                    || !mActorStats[i]->getAiSequence().isInCombat()
                     || !inProcessingRange))
                 {
-                    iter->first.getClass().getCreatureStats(iter->first).setHitAttemptActorId(-1);
-                    if (player.getClass().getCreatureStats(player).getHitAttemptActorId() == iter->first.getClass().getCreatureStats(iter->first).getActorId())
+                    mActorStats[i]->setHitAttemptActorId(-1);
+                    if (player.getClass().getCreatureStats(player).getHitAttemptActorId() == mActorStats[i]->getActorId())
                         player.getClass().getCreatureStats(player).setHitAttemptActorId(-1);
                 }
 
-                iter->first.getClass().getCreatureStats(iter->first).getActiveSpells().update(duration);
+                mActorStats[i]->getActiveSpells().update(duration);
 
                 // For dead actors we need to update looping spell particles
-                if (iter->first.getClass().getCreatureStats(iter->first).isDead())
+                if (mActorStats[i]->isDead())
                 {
                     // They can be added during the death animation
-                    if (!iter->first.getClass().getCreatureStats(iter->first).isDeathAnimationFinished())
-                        adjustMagicEffects(iter->first);
+                    if (!mActorStats[i]->isDeathAnimationFinished())
+                        adjustMagicEffects(actor);
                     ctrl->updateContinuousVfx();
                 }
                 else
                 {
                     bool cellChanged = world->hasCellChanged();
-                    MWWorld::Ptr actor = iter->first; // make a copy of the map key to avoid it being invalidated when the player teleports
                     updateActor(actor, duration);
 
                     // Looping magic VFX update
@@ -1915,13 +2123,18 @@ namespace MWMechanics
                         if (timerUpdateAITargets == 0)
                         {
                             if (!isPlayer)
-                                adjustCommandedActor(iter->first);
-
-                            for(PtrActorMap::iterator it(mActors.begin()); it != mActors.end(); ++it)
                             {
-                                if (it->first == iter->first || isPlayer) // player is not AI-controlled
-                                    continue;
-                                engageCombat(iter->first, it->first, cachedAllies, it->first == player);
+                                adjustCommandedActor(actor);
+
+                                // player is not AI-controlled
+                                for (std::size_t j = 0; j < mActorObjects.size(); ++j)
+                                {
+                                    // Dead actors are rejected by engageCombat anyway, this just spares the lookups
+                                    if (j == i || !mActorObjects[j] || mActorStats[j]->isDead())
+                                        continue;
+                                    const MWWorld::Ptr target = mActorPtrs[j];
+                                    engageCombat(actor, target, cachedAllies, target == player);
+                                }
                             }
                         }
                         if (timerUpdateHeadTrack == 0)
@@ -1929,7 +2142,7 @@ namespace MWMechanics
                             float sqrHeadTrackDistance = std::numeric_limits<float>::max();
                             MWWorld::Ptr headTrackTarget;
 
-                            MWMechanics::CreatureStats& stats = iter->first.getClass().getCreatureStats(iter->first);
+                            MWMechanics::CreatureStats& stats = *mActorStats[i];
                             bool firstPersonPlayer = isPlayer && world->isFirstPerson();
                             bool inCombatOrPursue = stats.getAiSequence().isInCombat() || stats.getAiSequence().hasPackage(AiPackageTypeId::Pursue);
 
@@ -1938,11 +2151,12 @@ namespace MWMechanics
                             // 3. Player character does not use headtracking in the 1st-person view
                             if (!stats.getKnockedDown() && !firstPersonPlayer && !inCombatOrPursue)
                             {
-                                for(PtrActorMap::iterator it(mActors.begin()); it != mActors.end(); ++it)
+                                for (std::size_t j = 0; j < mActorObjects.size(); ++j)
                                 {
-                                    if (it->first == iter->first)
+                                    // Dead actors can not be tracked
+                                    if (j == i || !mActorObjects[j] || mActorStats[j]->isDead())
                                         continue;
-                                    updateHeadTracking(iter->first, it->first, headTrackTarget, sqrHeadTrackDistance);
+                                    updateHeadTracking(actor, mActorPtrs[j], headTrackTarget, sqrHeadTrackDistance);
                                 }
                             }
 
@@ -1960,42 +2174,43 @@ namespace MWMechanics
                             ctrl->setHeadTrackTarget(headTrackTarget);
                         }
 
-                        if (iter->first.getClass().isNpc() && iter->first != player)
-                            updateCrimePursuit(iter->first, duration);
+                        if (actor.getClass().isNpc() && !isPlayer)
+                            updateCrimePursuit(actor, duration);
 
-                        if (iter->first != player)
+                        if (!isPlayer)
                         {
-                            CreatureStats &stats = iter->first.getClass().getCreatureStats(iter->first);
-                            if (isConscious(iter->first))
+                            CreatureStats &stats = *mActorStats[i];
+                            if (isConscious(actor))
                             {
-                                stats.getAiSequence().execute(iter->first, *ctrl, duration);
-                                updateGreetingState(iter->first, *iter->second, timerUpdateHello > 0);
-                                playIdleDialogue(iter->first);
-                                updateMovementSpeed(iter->first);
+                                const CombatTargetRatings* targetRatings = i < mCombatTargetRatings.size() ? &mCombatTargetRatings[i] : nullptr;
+                                stats.getAiSequence().execute(actor, *ctrl, duration, /*outOfRange*/false, targetRatings);
+                                updateGreetingState(actor, *actorObject, timerUpdateHello > 0);
+                                playIdleDialogue(actor);
+                                updateMovementSpeed(actor);
                             }
                         }
                     }
-                    else if (aiActive && iter->first != player && isConscious(iter->first))
+                    else if (aiActive && !isPlayer && isConscious(actor))
                     {
-                        CreatureStats &stats = iter->first.getClass().getCreatureStats(iter->first);
-                        stats.getAiSequence().execute(iter->first, *ctrl, duration, /*outOfRange*/true);
+                        CreatureStats &stats = *mActorStats[i];
+                        stats.getAiSequence().execute(actor, *ctrl, duration, /*outOfRange*/true);
                     }
 
-                    if(iter->first.getClass().isNpc())
+                    if(actor.getClass().isNpc())
                     {
                         // We can not update drowning state for actors outside of AI distance - they can not resurface to breathe
                         if (inProcessingRange)
-                            updateDrowning(iter->first, duration, ctrl->isKnockedOut(), isPlayer);
+                            updateDrowning(actor, duration, ctrl->isKnockedOut(), isPlayer);
 
-                        calculateNpcStatModifiers(iter->first, duration);
+                        calculateNpcStatModifiers(actor, duration);
 
                         if (timerUpdateEquippedLight == 0)
-                            updateEquippedLight(iter->first, updateEquippedLightInterval, showTorches);
+                            updateEquippedLight(actor, updateEquippedLightInterval, showTorches);
                     }
                 }
             }
 
-            static const bool avoidCollisions = Settings::Manager::getBool("NPCs avoid collisions", "Game");
+            static const Settings::SettingValue<bool> avoidCollisions("NPCs avoid collisions", "Game");
             if (avoidCollisions)
                 predictAndAvoidCollisions();
 
@@ -2007,14 +2222,19 @@ namespace MWMechanics
 
             // Animation/movement update
             CharacterController* playerCharacter = nullptr;
-            for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
+            for (std::size_t i = 0; i < mActorObjects.size(); ++i)
             {
-                const float dist = (playerPos - iter->first.getRefData().getPosition().asVec3()).length();
-                bool isPlayer = iter->first == player;
-                CreatureStats &stats = iter->first.getClass().getCreatureStats(iter->first);
+                Actor* actorObject = mActorObjects[i];
+                if (!actorObject)
+                    continue;
+
+                const MWWorld::Ptr actor = mActorPtrs[i];
+                const float dist = (playerPos - actor.getRefData().getPosition().asVec3()).length();
+                bool isPlayer = actor == player;
+                CreatureStats &stats = *mActorStats[i];
                 // Actors with active AI should be able to move.
                 bool alwaysActive = false;
-                if (!isPlayer && isConscious(iter->first) && !stats.isParalyzed())
+                if (!isPlayer && isConscious(actor) && !stats.isParalyzed())
                 {
                     MWMechanics::AiSequence& seq = stats.getAiSequence();
                     alwaysActive = !seq.isEmpty() && seq.getActivePackage().alwaysActive();
@@ -2025,34 +2245,34 @@ namespace MWMechanics
                     activeFlag = 2;
                 int active = inRange ? activeFlag : 0;
 
-                CharacterController* ctrl = iter->second->getCharacterController();
+                CharacterController* ctrl = actorObject->getCharacterController();
                 ctrl->setActive(active);
 
                 if (!inRange)
                 {
-                    iter->first.getRefData().getBaseNode()->setNodeMask(0);
-                    world->setActorCollisionMode(iter->first, false, false);
+                    actor.getRefData().getBaseNode()->setNodeMask(0);
+                    world->setActorCollisionMode(actor, false, false);
                     continue;
                 }
                 else if (!isPlayer)
-                    iter->first.getRefData().getBaseNode()->setNodeMask(MWRender::Mask_Actor);
+                    actor.getRefData().getBaseNode()->setNodeMask(MWRender::Mask_Actor);
 
-                const bool isDead = iter->first.getClass().getCreatureStats(iter->first).isDead();
-                if (!isDead && (!godmode || !isPlayer) && iter->first.getClass().getCreatureStats(iter->first).isParalyzed())
+                const bool isDead = stats.isDead();
+                if (!isDead && (!godmode || !isPlayer) && stats.isParalyzed())
                     ctrl->skipAnim();
 
                 // Handle player last, in case a cell transition occurs by casting a teleportation spell
                 // (would invalidate the iterator)
-                if (iter->first == getPlayer())
+                if (actor == getPlayer())
                 {
                     playerCharacter = ctrl;
                     continue;
                 }
 
-                world->setActorCollisionMode(iter->first, true, !iter->first.getClass().getCreatureStats(iter->first).isDeathAnimationFinished());
+                world->setActorCollisionMode(actor, true, !stats.isDeathAnimationFinished());
                 ctrl->update(duration);
 
-                updateVisibility(iter->first, ctrl);
+                updateVisibility(actor, ctrl);
             }
 
             if (playerCharacter)
@@ -2061,22 +2281,22 @@ namespace MWMechanics
                 playerCharacter->setVisibility(1.f);
             }
 
-            for(PtrActorMap::iterator iter(mActors.begin()); iter != mActors.end(); ++iter)
+            for (CreatureStats* stats : mActorStats)
             {
-                const MWWorld::Class &cls = iter->first.getClass();
-                CreatureStats &stats = cls.getCreatureStats(iter->first);
+                if (!stats)
+                    continue;
 
                 //KnockedOutOneFrameLogic
                 //Used for "OnKnockedOut" command
                 //Put here to ensure that it's run for PRECISELY one frame.
-                if (stats.getKnockedDown() && !stats.getKnockedDownOneFrame() && !stats.getKnockedDownOverOneFrame())
+                if (stats->getKnockedDown() && !stats->getKnockedDownOneFrame() && !stats->getKnockedDownOverOneFrame())
                 { //Start it for one frame if nessesary
-                    stats.setKnockedDownOneFrame(true);
+                    stats->setKnockedDownOneFrame(true);
                 }
-                else if (stats.getKnockedDownOneFrame() && !stats.getKnockedDownOverOneFrame())
+                else if (stats->getKnockedDownOneFrame() && !stats->getKnockedDownOverOneFrame())
                 { //Turn off KnockedOutOneframe
-                    stats.setKnockedDownOneFrame(false);
-                    stats.setKnockedDownOverOneFrame(true);
+                    stats->setKnockedDownOneFrame(false);
+                    stats->setKnockedDownOverOneFrame(true);
                 }
             }
 
@@ -2128,7 +2348,7 @@ namespace MWMechanics
                 MWBase::Environment::get().getDialogueManager()->say(iter->first, "hit");
 
                 // Apply soultrap
-                if (iter->first.getTypeName() == typeid(ESM::Creature).name())
+                if (iter->first.getType() == MWWorld::RefType::Creature)
                 {
                     SoulTrap soulTrap (iter->first);
                     stats.getActiveSpells().visitEffectSources(soulTrap);
@@ -2633,6 +2853,10 @@ namespace MWMechanics
             it->second = nullptr;
         }
         mActors.clear();
+        mActorPtrs.clear();
+        mActorObjects.clear();
+        mActorStats.clear();
+        mCombatTargetRatings.clear();
         mDeathCount.clear();
     }
 
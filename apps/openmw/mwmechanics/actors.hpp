@@ -7,7 +7,10 @@
 #include <list>
 #include <map>
 
+#include <osg/ref_ptr>
+
 #include "../mwmechanics/actorutil.hpp"
+#include "../mwmechanics/aisequence.hpp"
 
 namespace ESM
 {
@@ -25,6 +28,11 @@ namespace Loading
     class Listener;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWWorld
 {
     class Ptr;
@@ -207,7 +215,28 @@ namespace MWMechanics
     private:
         void updateVisibility (const MWWorld::Ptr& ptr, CharacterController* ctrl);
 
+        void addActorEntry (const MWWorld::Ptr& ptr, Actor* actor);
+        void removeActorEntry (const Actor* actor);
+        void updateActorEntries ();
+        ///< Drop the entries of removed actors and refresh the cached creature stats
+
+        void rateCombatTargets (const MWWorld::Ptr& player, const osg::Vec3f& playerPos);
+        ///< Rate the targets of all actors in combat for AiSequence::execute(), spreading the work over
+        /// mCombatRatingQueue if there is one
+
         PtrActorMap mActors;
+
+        // The registered actors again, as parallel arrays in registration order that update() walks
+        // instead of the nodes of mActors. Removing an actor only clears its entry (so indices stay valid
+        // while update() runs), updateActorEntries() compacts them at the start of the next update().
+        std::vector<MWWorld::Ptr> mActorPtrs;
+        std::vector<Actor*> mActorObjects;
+        std::vector<CreatureStats*> mActorStats;
+        // Combat target ratings of the actors, indexed like the arrays above and filled by rateCombatTargets()
+        std::vector<CombatTargetRatings> mCombatTargetRatings;
+        // Worker threads for rateCombatTargets(), nullptr to rate on the main thread only
+        osg::ref_ptr<SceneUtil::WorkQueue> mCombatRatingQueue;
+        int mCombatRatingThreads;
         float mTimerDisposeSummonsCorpses;
         float mActorsProcessingRange;
 
@@ -198,7 +198,7 @@ namespace MWMechanics
 
             if (characterController.readyToPrepareAttack())
             {
-                currentAction = prepareNextAction(actor, target);
+                currentAction = prepareNextAction(actor, target, storage.mCombatSpells);
                 actionCooldown = currentAction->getActionCooldown();
             }
         }
@@ -10,6 +10,7 @@
 #include "pathfinding.hpp"
 #include "movement.hpp"
 #include "obstacle.hpp"
+#include "aicombataction.hpp"
 
 namespace ESM
 {
@@ -21,8 +22,6 @@ namespace ESM
 
 namespace MWMechanics
 {
-    class Action;
-
     /// \brief This class holds the variables AiCombat needs which are deleted if the package becomes inactive.
     struct AiCombatStorage : AiTemporaryBase
     {
@@ -36,6 +35,7 @@ namespace MWMechanics
         osg::Vec3f mLastTargetPos;
         const MWWorld::CellStore* mCell;
         std::shared_ptr<Action> mCurrentAction;
+        CombatSpells mCombatSpells;
         float mActionCooldown;
         float mStrength;
         bool mForceNoShortcut;
@@ -66,6 +66,7 @@ namespace MWMechanics
         mLastTargetPos(0,0,0),
         mCell(nullptr),
         mCurrentAction(),
+        mCombatSpells(),
         mActionCooldown(0.0f),
         mStrength(),
         mForceNoShortcut(false),
@@ -19,6 +19,13 @@
 #include "spellpriority.hpp"
 #include "weapontype.hpp"
 
+namespace
+{
+    // Item types that can be enchanted, skipping the rest saves looking up their enchantment
+    const int sEnchantableTypes = MWWorld::ContainerStore::Type_Armor | MWWorld::ContainerStore::Type_Book
+        | MWWorld::ContainerStore::Type_Clothing | MWWorld::ContainerStore::Type_Weapon;
+}
+
 namespace MWMechanics
 {
     float suggestCombatRange(int rangeTypes)
@@ -141,10 +148,36 @@ namespace MWMechanics
         return mWeapon.get<ESM::Weapon>()->mBase;
     }
 
-    std::shared_ptr<Action> prepareNextAction(const MWWorld::Ptr &actor, const MWWorld::Ptr &enemy)
+    const std::vector<const ESM::Spell*>& CombatSpells::get(const MWWorld::Ptr& actor)
     {
-        Spells& spells = actor.getClass().getCreatureStats(actor).getSpells();
+        const Spells& spells = actor.getClass().getCreatureStats(actor).getSpells();
+        if (mSpells == &spells && mRevision == spells.getRevision())
+            return mList;
 
+        mSpells = &spells;
+        mRevision = spells.getRevision();
+        mList.clear();
+
+        const ESM::Race* race = nullptr;
+        if (actor.getClass().isNpc())
+            race = MWBase::Environment::get().getWorld()->getStore().get<ESM::Race>().find(actor.get<ESM::NPC>()->mBase->mRace);
+
+        // rateSpell() rejects these regardless of the situation
+        for (Spells::TIterator it = spells.begin(); it != spells.end(); ++it)
+        {
+            const ESM::Spell* spell = it->first;
+            if (spell->mData.mType != ESM::Spell::ST_Spell)
+                continue;
+            if (race && race->mPowers.exists(spell->mId))
+                continue;
+            mList.push_back(spell);
+        }
+
+        return mList;
+    }
+
+    std::shared_ptr<Action> prepareNextAction(const MWWorld::Ptr &actor, const MWWorld::Ptr &enemy, CombatSpells& combatSpells)
+    {
         float bestActionRating = 0.f;
         float antiFleeRating = 0.f;
         // Default to hand-to-hand combat
@@ -159,7 +192,7 @@ namespace MWMechanics
         {
             MWWorld::InventoryStore& store = actor.getClass().getInventoryStore(actor);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Potion); it != store.end(); ++it)
             {
                 float rating = ratePotion(*it, actor);
                 if (rating > bestActionRating)
@@ -170,7 +203,7 @@ namespace MWMechanics
                 }
             }
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(sEnchantableTypes); it != store.end(); ++it)
             {
                 float rating = rateMagicItem(*it, actor, enemy);
                 if (rating > bestActionRating)
@@ -187,7 +220,7 @@ namespace MWMechanics
             MWWorld::Ptr bestBolt;
             float bestBoltRating = rateAmmo(actor, enemy, bestBolt, ESM::Weapon::Bolt);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon); it != store.end(); ++it)
             {
                 float rating = rateWeapon(*it, actor, enemy, -1, bestArrowRating, bestBoltRating);
                 if (rating > bestActionRating)
@@ -208,14 +241,14 @@ namespace MWMechanics
             }
         }
 
-        for (Spells::TIterator it = spells.begin(); it != spells.end(); ++it)
+        for (const ESM::Spell* spell : combatSpells.get(actor))
         {
-            float rating = rateSpell(it->first, actor, enemy);
+            float rating = rateSpell(spell, actor, enemy);
             if (rating > bestActionRating)
             {
                 bestActionRating = rating;
-                bestAction.reset(new ActionSpell(it->first->mId));
-                antiFleeRating = vanillaRateSpell(it->first, actor, enemy);
+                bestAction.reset(new ActionSpell(spell->mId));
+                antiFleeRating = vanillaRateSpell(spell, actor, enemy);
             }
         }
 
@@ -243,7 +276,7 @@ namespace MWMechanics
         {
             MWWorld::InventoryStore& store = actor.getClass().getInventoryStore(actor);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(sEnchantableTypes); it != store.end(); ++it)
             {
                 float rating = rateMagicItem(*it, actor, enemy);
                 if (rating > bestActionRating)
@@ -256,7 +289,7 @@ namespace MWMechanics
 
             float bestBoltRating = rateAmmo(actor, enemy, ESM::Weapon::Bolt);
 
-            for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+            for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon); it != store.end(); ++it)
             {
                 float rating = rateWeapon(*it, actor, enemy, -1, bestArrowRating, bestBoltRating);
                 if (rating > bestActionRating)
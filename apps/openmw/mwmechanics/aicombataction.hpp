@@ -2,6 +2,7 @@
 #define OPENMW_AICOMBAT_ACTION_H
 
 #include <memory>
+#include <vector>
 
 #include <components/esm/loadspel.hpp>
 
@@ -10,6 +11,8 @@
 
 namespace MWMechanics
 {
+    class Spells;
+
     class Action
     {
     public:
@@ -87,7 +90,21 @@ namespace MWMechanics
         const ESM::Weapon* getWeapon() const override;
     };
 
-    std::shared_ptr<Action> prepareNextAction (const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy);
+    /// Spells of an actor that can be chosen as a combat action, kept between decisions.
+    /** Abilities, powers, diseases and racial spells are never chosen, so they are filtered out once
+        instead of being rated on every decision. Rebuilt when the spell list of the actor changes. **/
+    class CombatSpells
+    {
+    public:
+        const std::vector<const ESM::Spell*>& get(const MWWorld::Ptr& actor);
+
+    private:
+        const Spells* mSpells = nullptr;
+        unsigned int mRevision = 0;
+        std::vector<const ESM::Spell*> mList;
+    };
+
+    std::shared_ptr<Action> prepareNextAction (const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, CombatSpells& combatSpells);
     float getBestActionRating(const MWWorld::Ptr &actor, const MWWorld::Ptr &enemy);
 
     float getDistanceMinusHalfExtents(const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, bool minusZDist=false);
@@ -5,7 +5,7 @@
 #include <components/esm/loadmgef.hpp>
 #include <components/detournavigator/navigator.hpp>
 #include <components/misc/coordinateconverter.hpp>
-#include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include "../mwbase/world.hpp"
 #include "../mwbase/environment.hpp"
@@ -97,6 +97,15 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
     const float distToTarget = distance(position, dest);
     const bool isDestReached = (distToTarget <= destTolerance);
 
+    if (mPathFinder.updatePendingPath())
+    {
+        mRotateOnTheRunChecks = 3;
+
+        //Adds the final destination to the path, if the path found for the previous destination ends far from it
+        if (!mPathFinder.getPath().empty() && distance(dest, mPathFinder.getPath().back()) > 100)
+            mPathFinder.addPointToPath(dest);
+    }
+
     if (!isDestReached && mTimer > AI_REACTION_TIME)
     {
         if (actor.getClass().isBipedal(actor))
@@ -115,12 +124,13 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
             if (wasShortcutting || doesPathNeedRecalc(dest, actor)) // if need to rebuild path
             {
                 const auto pathfindingHalfExtents = world->getPathfindingHalfExtents(actor);
-                mPathFinder.buildPath(actor, position, dest, actor.getCell(), getPathGridGraph(actor.getCell()),
-                    pathfindingHalfExtents, getNavigatorFlags(actor), getAreaCosts(actor));
-                mRotateOnTheRunChecks = 3;
+                const bool isPathBuilt = mPathFinder.requestPath(actor, position, dest, actor.getCell(),
+                    getPathGridGraph(actor.getCell()), pathfindingHalfExtents, getNavigatorFlags(actor), getAreaCosts(actor));
+                if (isPathBuilt)
+                    mRotateOnTheRunChecks = 3;
 
                 // give priority to go directly on target if there is minimal opportunity
-                if (destInLOS && mPathFinder.getPath().size() > 1)
+                if (isPathBuilt && destInLOS && mPathFinder.getPath().size() > 1)
                 {
                     // get point just before dest
                     auto pPointBeforeDest = mPathFinder.getPath().rbegin() + 1;
@@ -161,6 +171,14 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
         return true;
     }
 
+    if (mPathFinder.getPath().empty() && mPathFinder.isPathPending()) // waiting for a path from the background thread
+    {
+        actor.getClass().getMovementSettings(actor).mPosition[0] = 0;
+        actor.getClass().getMovementSettings(actor).mPosition[1] = 0;
+        zTurn(actor, getZAngleToPoint(position, dest));
+        return false;
+    }
+
     world->updateActorPath(actor, mPathFinder.getPath(), halfExtents, position, dest);
 
     if (mRotateOnTheRunChecks == 0
@@ -178,7 +196,7 @@ bool MWMechanics::AiPackage::pathTo(const MWWorld::Ptr& actor, const osg::Vec3f&
     const auto destination = mPathFinder.getPath().empty() ? dest : mPathFinder.getPath().front();
     mObstacleCheck.update(actor, destination, duration);
 
-    static const bool smoothMovement = Settings::Manager::getBool("smooth movement", "Game");
+    static const Settings::SettingValue<bool> smoothMovement("smooth movement", "Game");
     if (smoothMovement)
     {
         const float smoothTurnReservedDist = 150;
@@ -199,9 +199,23 @@ namespace
         return (packageTypeId >= AiPackageTypeId::Wander &&
                 packageTypeId <= AiPackageTypeId::Activate);
     }
+
+    float getTargetRating(const MWWorld::Ptr& actor, const MWWorld::Ptr& target, const CombatTargetRatings* targetRatings)
+    {
+        if (targetRatings)
+        {
+            for (const auto& rating : *targetRatings)
+            {
+                if (rating.first == target)
+                    return rating.second;
+            }
+        }
+        return getBestActionRating(actor, target);
+    }
 }
 
-void AiSequence::execute (const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange)
+void AiSequence::execute (const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange,
+                          const CombatTargetRatings* targetRatings)
 {
     if(actor != getPlayer())
     {
@@ -243,7 +257,7 @@ void AiSequence::execute (const MWWorld::Ptr& actor, CharacterController& charac
                 }
                 else
                 {
-                    float rating = MWMechanics::getBestActionRating(actor, target);
+                    float rating = getTargetRating(actor, target, targetRatings);
 
                     const ESM::Position &targetPos = target.getRefData().getPosition();
 
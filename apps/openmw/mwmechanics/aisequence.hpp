@@ -3,6 +3,8 @@
 
 #include <list>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "aistate.hpp"
 #include "aipackagetypeid.hpp"
@@ -33,6 +35,9 @@ namespace MWMechanics
     struct AiTemporaryBase;
     typedef DerivedClassStorage<AiTemporaryBase> AiState;
 
+    /// Targets of an actor's combat packages and their ratings, see getBestActionRating()
+    typedef std::vector<std::pair<MWWorld::Ptr, float>> CombatTargetRatings;
+
     /// \brief Sequence of AI-packages for a single actor
     /** The top-most AI package is run each frame. When completed, it is removed from the stack. **/
     class AiSequence
@@ -112,7 +117,10 @@ namespace MWMechanics
             void stopPursuit();
 
             /// Execute current package, switching if needed.
-            void execute (const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange=false);
+            /** @param targetRatings Ratings of combat targets computed ahead of this call. Targets that are
+                missing from it are rated on the spot. **/
+            void execute (const MWWorld::Ptr& actor, CharacterController& characterController, float duration, bool outOfRange=false,
+                          const CombatTargetRatings* targetRatings=nullptr);
 
             /// Simulate the passing of time using the currently active AI package
             void fastForward(const MWWorld::Ptr &actor);
@@ -25,6 +25,7 @@
 #include <components/misc/rng.hpp>
 
 #include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include <components/sceneutil/positionattitudetransform.hpp>
 
@@ -372,7 +373,7 @@ void CharacterController::refreshJumpAnims(const std::string& weapShortGroup, Ju
 
 bool CharacterController::onOpen()
 {
-    if (mPtr.getTypeName() == typeid(ESM::Container).name())
+    if (mPtr.getType() == MWWorld::RefType::Container)
     {
         if (!mAnimation->hasAnimation("containeropen"))
             return true;
@@ -393,7 +394,7 @@ bool CharacterController::onOpen()
 
 void CharacterController::onClose()
 {
-    if (mPtr.getTypeName() == typeid(ESM::Container).name())
+    if (mPtr.getType() == MWWorld::RefType::Container)
     {
         if (!mAnimation->hasAnimation("containerclose"))
             return;
@@ -580,7 +581,7 @@ void CharacterController::refreshMovementAnims(const std::string& weapShortGroup
             // even if we are running. This must be replicated, otherwise the observed speed would differ drastically.
             std::string anim = mCurrentMovement;
             mAdjustMovementAnimSpeed = true;
-            if (mPtr.getClass().getTypeName() == typeid(ESM::Creature).name()
+            if (mPtr.getClass().getType() == MWWorld::RefType::Creature
                     && !(mPtr.get<ESM::Creature>()->mBase->mFlags & ESM::Creature::Flies))
             {
                 CharacterState walkState = runStateToWalkState(mMovementState);
@@ -1426,7 +1427,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
     {
         MWWorld::InventoryStore &inv = cls.getInventoryStore(mPtr);
         MWWorld::ConstContainerStoreIterator weapon = getActiveWeapon(mPtr, &weaptype);
-        isWeapon = (weapon != inv.end() && weapon->getTypeName() == typeid(ESM::Weapon).name());
+        isWeapon = (weapon != inv.end() && weapon->getType() == MWWorld::RefType::Weapon);
         if (isWeapon)
         {
             weapSpeed = weapon->get<ESM::Weapon>()->mBase->mData.mSpeed;
@@ -1461,7 +1462,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
             mAttackStrength = 0;
 
             // Randomize attacks for non-bipedal creatures with Weapon flag
-            if (mPtr.getClass().getTypeName() == typeid(ESM::Creature).name() &&
+            if (mPtr.getClass().getType() == MWWorld::RefType::Creature &&
                 !mPtr.getClass().isBipedal(mPtr) &&
                 (!mAnimation->hasAnimation(mCurrentWeapon) || isRandomAttackAnimation(mCurrentWeapon)))
             {
@@ -1501,7 +1502,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
                     }
                 }
 
-                static const bool useCastingAnimations = Settings::Manager::getBool("use magic item animations", "Game");
+                static const Settings::SettingValue<bool> useCastingAnimations("use magic item animations", "Game");
                 if (isMagicItem && !useCastingAnimations)
                 {
                     // Enchanted items by default do not use casting animations
@@ -1584,9 +1585,9 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
 
                 if(!target.isEmpty())
                 {
-                    if(item.getTypeName() == typeid(ESM::Lockpick).name())
+                    if(item.getType() == MWWorld::RefType::Lockpick)
                         Security(mPtr).pickLock(target, item, resultMessage, resultSound);
-                    else if(item.getTypeName() == typeid(ESM::Probe).name())
+                    else if(item.getType() == MWWorld::RefType::Probe)
                         Security(mPtr).probeTrap(target, item, resultMessage, resultSound);
                 }
                 mAnimation->play(mCurrentWeapon, priorityWeapon,
@@ -1620,7 +1621,8 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
                 {
                     if(mPtr == getPlayer())
                     {
-                        if (Settings::Manager::getBool("best attack", "Game"))
+                        static const Settings::SettingValue<bool> bestAttack("best attack", "Game");
+                        if (bestAttack)
                         {
                             if (isWeapon)
                             {
@@ -1860,7 +1862,7 @@ bool CharacterController::updateWeaponState(CharacterState& idle)
     {
         const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
         MWWorld::ConstContainerStoreIterator torch = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-        if(torch != inv.end() && torch->getTypeName() == typeid(ESM::Light).name()
+        if(torch != inv.end() && torch->getType() == MWWorld::RefType::Light
                 && updateCarriedLeftVisible(mWeaponType))
 
         {
@@ -1916,7 +1918,7 @@ void CharacterController::update(float duration, bool animationOnly)
 
     float scale = mPtr.getCellRef().getScale();
 
-    static const bool normalizeSpeed = Settings::Manager::getBool("normalise race speed", "Game");
+    static const Settings::SettingValue<bool> normalizeSpeed("normalise race speed", "Game");
     if (!normalizeSpeed && mPtr.getClass().isNpc())
     {
         const ESM::NPC* npc = mPtr.get<ESM::NPC>()->mBase;
@@ -1964,10 +1966,11 @@ void CharacterController::update(float duration, bool animationOnly)
         if (isPlayer && !isrunning && !sneak && !flying && movementSettings.mSpeedFactor <= 0.5f)
             movementSettings.mSpeedFactor *= 2.f;
 
-        static const bool smoothMovement = Settings::Manager::getBool("smooth movement", "Game");
+        static const Settings::SettingValue<bool> smoothMovement("smooth movement", "Game");
         if (smoothMovement && !isFirstPersonPlayer)
         {
-            static const float playerTurningCoef = 1.0 / std::max(0.01f, Settings::Manager::getFloat("smooth movement player turning delay", "Game"));
+            static const Settings::SettingValue<float> playerTurningDelay("smooth movement player turning delay", "Game");
+            const float playerTurningCoef = 1.f / std::max(0.01f, playerTurningDelay.get());
             float angle = mPtr.getRefData().getPosition().rot[2];
             osg::Vec2f targetSpeed = Misc::rotateVec2f(osg::Vec2f(vec.x(), vec.y()), -angle) * movementSettings.mSpeedFactor;
             osg::Vec2f delta = targetSpeed - mSmoothedSpeed;
@@ -2011,7 +2014,7 @@ void CharacterController::update(float duration, bool animationOnly)
 
         float effectiveRotation = rot.z();
         bool canMove = cls.getMaxSpeed(mPtr) > 0;
-        static const bool turnToMovementDirection = Settings::Manager::getBool("turn to movement direction", "Game");
+        static const Settings::SettingValue<bool> turnToMovementDirection("turn to movement direction", "Game");
         if (!turnToMovementDirection || isFirstPersonPlayer)
             movementSettings.mIsStrafing = std::abs(vec.x()) > std::abs(vec.y()) * 2;
         else if (canMove)
@@ -2277,11 +2280,12 @@ void CharacterController::update(float duration, bool animationOnly)
             swimmingPitch += osg::clampBetween(targetSwimmingPitch - swimmingPitch, -maxSwimPitchDelta, maxSwimPitchDelta);
             mAnimation->setBodyPitchRadians(swimmingPitch);
         }
-        static const bool swimUpwardCorrection = Settings::Manager::getBool("swim upward correction", "Game");
+        static const Settings::SettingValue<bool> swimUpwardCorrection("swim upward correction", "Game");
         if (inwater && isPlayer && !isFirstPersonPlayer && swimUpwardCorrection)
         {
-            static const float swimUpwardCoef = Settings::Manager::getFloat("swim upward coef", "Game");
-            static const float swimForwardCoef = sqrtf(1.0f - swimUpwardCoef * swimUpwardCoef);
+            static const Settings::SettingValue<float> swimUpwardCoefValue("swim upward coef", "Game");
+            const float swimUpwardCoef = swimUpwardCoefValue;
+            const float swimForwardCoef = sqrtf(1.0f - swimUpwardCoef * swimUpwardCoef);
             vec.z() = std::abs(vec.y()) * swimUpwardCoef;
             vec.y() *= swimForwardCoef;
         }
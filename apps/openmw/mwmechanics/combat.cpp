@@ -1,7 +1,7 @@
 #include "combat.hpp"
 
 #include <components/misc/rng.hpp>
-#include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include <components/sceneutil/positionattitudetransform.hpp>
 
@@ -71,7 +71,7 @@ namespace MWMechanics
 
         MWWorld::InventoryStore& inv = blocker.getClass().getInventoryStore(blocker);
         MWWorld::ContainerStoreIterator shield = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-        if (shield == inv.end() || shield->getTypeName() != typeid(ESM::Armor).name())
+        if (shield == inv.end() || shield->getType() != MWWorld::RefType::Armor)
             return false;
 
         if (!blocker.getRefData().getBaseNode())
@@ -157,7 +157,8 @@ namespace MWMechanics
         bool isMagical = flags & ESM::Weapon::Magical;
         bool isEnchanted = !weapon.getClass().getEnchantment(weapon).empty();
 
-        return !isSilver && !isMagical && (!isEnchanted || !Settings::Manager::getBool("enchanted weapons are magical", "Game"));
+        static const Settings::SettingValue<bool> enchantedWeaponsAreMagical("enchanted weapons are magical", "Game");
+        return !isSilver && !isMagical && (!isEnchanted || !enchantedWeaponsAreMagical);
     }
 
     void resistNormalWeapon(const MWWorld::Ptr &actor, const MWWorld::Ptr& attacker, const MWWorld::Ptr &weapon, float &damage)
@@ -226,7 +227,8 @@ namespace MWMechanics
             damage += attack[0] + ((attack[1] - attack[0]) * attackStrength);
 
             adjustWeaponDamage(damage, weapon, attacker);
-            if (weapon == projectile || Settings::Manager::getBool("only appropriate ammunition bypasses resistance", "Game") || isNormalWeapon(weapon))
+            static const Settings::SettingValue<bool> onlyAppropriateAmmunition("only appropriate ammunition bypasses resistance", "Game");
+            if (weapon == projectile || onlyAppropriateAmmunition || isNormalWeapon(weapon))
                 resistNormalWeapon(victim, attacker, projectile, damage);
             applyWerewolfDamageMult(victim, projectile, damage);
 
@@ -415,7 +417,8 @@ namespace MWMechanics
         // 0 = Do not factor strength into hand-to-hand combat.
         // 1 = Factor into werewolf hand-to-hand combat.
         // 2 = Ignore werewolves.
-        int factorStrength = Settings::Manager::getInt("strength influences hand to hand", "Game");
+        static const Settings::SettingValue<int> strengthInfluencesHandToHand("strength influences hand to hand", "Game");
+        const int factorStrength = strengthInfluencesHandToHand;
         if (factorStrength == 1 || (factorStrength == 2 && !isWerewolf)) {
             damage *= attacker.getClass().getCreatureStats(attacker).getAttribute(ESM::Attribute::Strength).getModified() / 40.0f;
         }
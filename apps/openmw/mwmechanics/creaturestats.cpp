@@ -22,7 +22,7 @@ namespace MWMechanics
           mTalkedTo (false), mAlarmed (false), mAttacked (false),
           mKnockdown(false), mKnockdownOneFrame(false), mKnockdownOverOneFrame(false),
           mHitRecovery(false), mBlock(false), mMovementFlags(0),
-          mFallHeight(0), mRecalcMagicka(false), mLastRestock(0,0), mGoldPool(0), mActorId(-1), mHitAttemptActorId(-1),
+          mFallHeight(0), mRecalcMagicka(false), mMagicEffectSourcesValid(false), mLastRestock(0,0), mGoldPool(0), mActorId(-1), mHitAttemptActorId(-1),
           mDeathAnimation(-1), mTimeOfDeath(), mSideMovementAngle(0), mLevel (0)
     {
         for (int i=0; i<4; ++i)
@@ -213,6 +213,26 @@ namespace MWMechanics
             mRecalcMagicka = true;
 
         mMagicEffects.setModifiers(effects);
+        mMagicEffectSourcesValid = false;
+    }
+
+    bool CreatureStats::hasMagicEffectSources(unsigned int spells, unsigned int activeSpells, unsigned int items) const
+    {
+        return mMagicEffectSourcesValid && mMagicEffectSources[0] == spells
+            && mMagicEffectSources[1] == activeSpells && mMagicEffectSources[2] == items;
+    }
+
+    void CreatureStats::setMagicEffectSources(unsigned int spells, unsigned int activeSpells, unsigned int items)
+    {
+        mMagicEffectSources[0] = spells;
+        mMagicEffectSources[1] = activeSpells;
+        mMagicEffectSources[2] = items;
+        mMagicEffectSourcesValid = true;
+    }
+
+    void CreatureStats::invalidateMagicEffectSources()
+    {
+        mMagicEffectSourcesValid = false;
     }
 
     void CreatureStats::setAiSetting (AiSetting index, Stat<int> value)
@@ -601,6 +621,7 @@ namespace MWMechanics
         mActiveSpells.readState(state.mActiveSpells);
         mAiSequence.readState(state.mAiSequence);
         mMagicEffects.readState(state.mMagicEffects);
+        mMagicEffectSourcesValid = false;
 
         mSummonedCreatures = state.mSummonedCreatureMap;
         mSummonGraveyard = state.mSummonGraveyard;
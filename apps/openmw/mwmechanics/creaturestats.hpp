@@ -66,6 +66,10 @@ namespace MWMechanics
 
         bool mRecalcMagicka;
 
+        // Revisions of the spells, active spells and equipped items the modifiers of mMagicEffects were built from
+        unsigned int mMagicEffectSources[3];
+        bool mMagicEffectSourcesValid;
+
         // For merchants: the last time items were restocked and gold pool refilled.
         MWWorld::TimeStamp mLastRestock;
 
@@ -153,6 +157,15 @@ namespace MWMechanics
         /// Set Modifier for each magic effect according to \a effects. Does not touch Base values.
         void modifyMagicEffects(const MagicEffects &effects);
 
+        /// Check if the Modifiers of magic effects were built from effect sources with the given revisions.
+        bool hasMagicEffectSources(unsigned int spells, unsigned int activeSpells, unsigned int items) const;
+
+        /// Remember the revisions of the effect sources the last modifyMagicEffects() call was built from.
+        void setMagicEffectSources(unsigned int spells, unsigned int activeSpells, unsigned int items);
+
+        /// Force the magic effects to be rebuilt after their Modifiers were changed directly.
+        void invalidateMagicEffectSources();
+
         void setAttackingOrSpell(bool attackingOrSpell);
 
         void setLevel(int level);
@@ -22,6 +22,7 @@ namespace MWMechanics
     Enchanting::Enchanting()
         : mCastStyle(ESM::Enchantment::CastOnce)
         , mSelfEnchanting(false)
+        , mObjectType(MWWorld::RefType::Count)
         , mWeaponType(-1)
     {}
 
@@ -29,11 +30,11 @@ namespace MWMechanics
     {
         mOldItemPtr=oldItem;
         mWeaponType = -1;
-        mObjectType.clear();
+        mObjectType = MWWorld::RefType::Count;
         if(!itemEmpty())
         {
-            mObjectType = mOldItemPtr.getTypeName();
-            if (mObjectType == typeid(ESM::Weapon).name())
+            mObjectType = mOldItemPtr.getType();
+            if (mObjectType == MWWorld::RefType::Weapon)
                 mWeaponType = mOldItemPtr.get<ESM::Weapon>()->mBase->mData.mType;
         }
     }
@@ -115,7 +116,7 @@ namespace MWMechanics
 
         const bool powerfulSoul = getGemCharge() >= \
                 MWBase::Environment::get().getWorld()->getStore().get<ESM::GameSetting>().find ("iSoulAmountForConstantEffect")->mValue.getInteger();
-        if ((mObjectType == typeid(ESM::Armor).name()) || (mObjectType == typeid(ESM::Clothing).name()))
+        if ((mObjectType == MWWorld::RefType::Armor) || (mObjectType == MWWorld::RefType::Clothing))
         { // Armor or Clothing
             switch(mCastStyle)
             {
@@ -150,7 +151,7 @@ namespace MWMechanics
                     return;
             }
         }
-        else if(mObjectType == typeid(ESM::Book).name())
+        else if(mObjectType == MWWorld::RefType::Book)
         { // Scroll or Book
             mCastStyle = ESM::Enchantment::CastOnce;
             return;
@@ -1,7 +1,7 @@
 #include "linkedeffects.hpp"
 
 #include <components/misc/rng.hpp>
-#include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/world.hpp"
@@ -62,7 +62,8 @@ namespace MWMechanics
         absorbEffects.emplace_back(absorbEffect);
 
         // Morrowind negates reflected Absorb spells so the original caster won't be harmed.
-        if (reflected && Settings::Manager::getBool("classic reflected absorb spells behavior", "Game"))
+        static const Settings::SettingValue<bool> classicReflectedAbsorb("classic reflected absorb spells behavior", "Game");
+        if (reflected && classicReflectedAbsorb)
         {
             target.getClass().getCreatureStats(target).getActiveSpells().addSpell(std::string(), true,
                             absorbEffects, source, caster.getClass().getCreatureStats(caster).getActorId());
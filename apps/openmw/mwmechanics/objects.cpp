@@ -88,7 +88,7 @@ void Objects::update(float duration, bool paused)
 
         for(auto& object : mObjects)
         {
-            if (object.first.getTypeName() != typeid(ESM::Container).name())
+            if (object.first.getType() != MWWorld::RefType::Container)
                 continue;
 
             if (object.second->isAnimPlaying("containeropen"))
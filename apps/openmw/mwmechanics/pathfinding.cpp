@@ -3,6 +3,7 @@
 #include <iterator>
 #include <limits>
 
+#include <components/detournavigator/asyncpathfinder.hpp>
 #include <components/detournavigator/exceptions.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/navigator.hpp>
@@ -315,6 +316,7 @@ namespace MWMechanics
 
     void PathFinder::buildStraightPath(const osg::Vec3f& endPoint)
     {
+        mPendingRequest.reset();
         mPath.clear();
         mPath.push_back(endPoint);
         mConstructed = true;
@@ -348,6 +350,7 @@ namespace MWMechanics
         const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph, const osg::Vec3f& halfExtents,
         const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts)
     {
+        mPendingRequest.reset();
         mPath.clear();
         mCell = cell;
 
@@ -369,6 +372,73 @@ namespace MWMechanics
         mConstructed = true;
     }
 
+    bool PathFinder::requestPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
+        const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph, const osg::Vec3f& halfExtents,
+        const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts)
+    {
+        const auto asyncPathFinder = MWBase::Environment::get().getWorld()->getAsyncPathFinder();
+
+        if (asyncPathFinder == nullptr
+            || actor.getClass().isPureWaterCreature(actor) || actor.getClass().isPureFlyingCreature(actor))
+        {
+            buildPath(actor, startPoint, endPoint, cell, pathgridGraph, halfExtents, flags, areaCosts);
+            return true;
+        }
+
+        // Still waiting for a path to the same destination, a new request would only delay it
+        if (mPendingRequest != nullptr && mPendingCell == cell
+                && (mPendingRequest->getQuery().mEnd - endPoint).length2() <= 100)
+            return false;
+
+        // Replacing the request releases the stale one, workers skip it if it is not started yet
+        mPendingRequest = asyncPathFinder->post(DetourNavigator::PathQuery {halfExtents, getPathStepSize(actor),
+            startPoint, endPoint, flags, areaCosts});
+        mPendingCell = cell;
+        mPendingPathgridGraph = &pathgridGraph;
+
+        return false;
+    }
+
+    bool PathFinder::updatePendingPath()
+    {
+        if (mPendingRequest == nullptr || !mPendingRequest->isDone())
+            return false;
+
+        const std::shared_ptr<DetourNavigator::PathRequest> request = std::move(mPendingRequest);
+
+        const auto& query = request->getQuery();
+        const auto status = request->getStatus();
+        const bool hasNavMesh = status != DetourNavigator::Status::NavMeshNotFound;
+
+        if (hasNavMesh && status != DetourNavigator::Status::Success)
+        {
+            Log(Debug::Debug) << "Build path by navigator error: \"" << DetourNavigator::getMessage(status)
+                << "\" from " << query.mStart << " to " << query.mEnd << " with flags ("
+                << DetourNavigator::WriteFlags {query.mIncludeFlags} << ")";
+        }
+
+        // Same fallback as in buildPath: try once more over pathgrid connections
+        if (hasNavMesh && request->getPath().empty() && !(query.mIncludeFlags & DetourNavigator::Flag_usePathgrid))
+        {
+            DetourNavigator::PathQuery retry = query;
+            retry.mIncludeFlags |= DetourNavigator::Flag_usePathgrid;
+            mPendingRequest = MWBase::Environment::get().getWorld()->getAsyncPathFinder()->post(retry);
+            return false;
+        }
+
+        mPath = request->getPath();
+        mCell = mPendingCell;
+
+        if (mPath.empty())
+            buildPathByPathgridImpl(query.mStart, query.mEnd, *mPendingPathgridGraph, std::back_inserter(mPath));
+
+        if (!hasNavMesh && mPath.empty())
+            mPath.push_back(query.mEnd);
+
+        mConstructed = true;
+        return true;
+    }
+
     bool PathFinder::buildPathByNavigatorImpl(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint,
         const osg::Vec3f& endPoint, const osg::Vec3f& halfExtents, const DetourNavigator::Flags flags,
         const DetourNavigator::AreaCosts& areaCosts, std::back_insert_iterator<std::deque<osg::Vec3f>> out)
@@ -4,12 +4,18 @@
 #include <deque>
 #include <cassert>
 #include <iterator>
+#include <memory>
 
 #include <components/detournavigator/flags.hpp>
 #include <components/detournavigator/areatype.hpp>
 #include <components/esm/defs.hpp>
 #include <components/esm/loadpgrd.hpp>
 
+namespace DetourNavigator
+{
+    class PathRequest;
+}
+
 namespace MWWorld
 {
     class CellStore;
@@ -75,6 +81,8 @@ namespace MWMechanics
             PathFinder()
                 : mConstructed(false)
                 , mCell(nullptr)
+                , mPendingCell(nullptr)
+                , mPendingPathgridGraph(nullptr)
             {
             }
 
@@ -83,6 +91,7 @@ namespace MWMechanics
                 mConstructed = false;
                 mPath.clear();
                 mCell = nullptr;
+                mPendingRequest.reset();
             }
 
             void buildStraightPath(const osg::Vec3f& endPoint);
@@ -98,6 +107,22 @@ namespace MWMechanics
                 const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph, const osg::Vec3f& halfExtents,
                 const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts);
 
+            /// Same as buildPath, but searches the navmesh on a background thread if it is enabled.
+            /// The current path is kept until the result is applied by updatePendingPath.
+            /// @return true if the path was built immediately
+            bool requestPath(const MWWorld::ConstPtr& actor, const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
+                const MWWorld::CellStore* cell, const PathgridGraph& pathgridGraph, const osg::Vec3f& halfExtents,
+                const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts);
+
+            /// Replace the path by the result of the last requestPath, if it is ready.
+            /// @return true if the path has been replaced
+            bool updatePendingPath();
+
+            bool isPathPending() const
+            {
+                return mPendingRequest != nullptr;
+            }
+
             void buildPathByNavMeshToNextPoint(const MWWorld::ConstPtr& actor, const osg::Vec3f& halfExtents,
                 const DetourNavigator::Flags flags, const DetourNavigator::AreaCosts& areaCosts);
 
@@ -106,7 +131,7 @@ namespace MWMechanics
 
             bool checkPathCompleted() const
             {
-                return mConstructed && mPath.empty();
+                return mConstructed && mPath.empty() && mPendingRequest == nullptr;
             }
 
             /// In radians
@@ -200,6 +225,10 @@ namespace MWMechanics
 
             const MWWorld::CellStore* mCell;
 
+            std::shared_ptr<DetourNavigator::PathRequest> mPendingRequest;
+            const MWWorld::CellStore* mPendingCell;
+            const PathgridGraph* mPendingPathgridGraph;
+
             void buildPathByPathgridImpl(const osg::Vec3f& startPoint, const osg::Vec3f& endPoint,
                 const PathgridGraph& pathgridGraph, std::back_insert_iterator<std::deque<osg::Vec3f>> out);
 
@@ -1,5 +1,8 @@
 #include "pathgrid.hpp"
 
+#include <algorithm>
+#include <vector>
+
 #include "../mwbase/world.hpp"
 #include "../mwbase/environment.hpp"
 
@@ -45,6 +48,111 @@ namespace
         //return distance(a, b);
         return manhattan(a, b);
     }
+
+    // Indexed binary min-heap keyed on fScore, plus the per-point search state.
+    // mHeapPos is the position of a point in mHeap, or one of the values below.
+    struct AStarScratch
+    {
+        static constexpr int sUnvisited = -1;
+        static constexpr int sClosed = -2;
+
+        std::vector<float> mGScore;
+        std::vector<float> mFScore;
+        std::vector<int> mParent;
+        std::vector<int> mHeapPos;
+        std::vector<int> mHeap;
+
+        void reset(std::size_t size)
+        {
+            mGScore.assign(size, -1);
+            mFScore.assign(size, -1);
+            mParent.assign(size, -1);
+            mHeapPos.assign(size, sUnvisited);
+            mHeap.clear();
+            mHeap.reserve(size);
+        }
+
+        bool empty() const { return mHeap.empty(); }
+        bool isOpen(int point) const { return mHeapPos[point] >= 0; }
+        bool isClosed(int point) const { return mHeapPos[point] == sClosed; }
+
+        void push(int point, float fScore)
+        {
+            mFScore[point] = fScore;
+            mHeap.push_back(point);
+            mHeapPos[point] = static_cast<int>(mHeap.size()) - 1;
+            siftUp(mHeapPos[point]);
+        }
+
+        void decrease(int point, float fScore)
+        {
+            mFScore[point] = fScore;
+            siftUp(mHeapPos[point]);
+        }
+
+        int pop()
+        {
+            const int top = mHeap.front();
+            mHeapPos[top] = sClosed;
+            const int last = mHeap.back();
+            mHeap.pop_back();
+            if (!mHeap.empty())
+            {
+                mHeap.front() = last;
+                mHeapPos[last] = 0;
+                siftDown(0);
+            }
+            return top;
+        }
+
+    private:
+        void place(int pos, int point)
+        {
+            mHeap[pos] = point;
+            mHeapPos[point] = pos;
+        }
+
+        void siftUp(int pos)
+        {
+            const int point = mHeap[pos];
+            while (pos > 0)
+            {
+                const int parent = (pos - 1) / 2;
+                if (mFScore[mHeap[parent]] <= mFScore[point])
+                    break;
+                place(pos, mHeap[parent]);
+                pos = parent;
+            }
+            place(pos, point);
+        }
+
+        void siftDown(int pos)
+        {
+            const int point = mHeap[pos];
+            const int size = static_cast<int>(mHeap.size());
+            while (true)
+            {
+                int child = 2 * pos + 1;
+                if (child >= size)
+                    break;
+                if (child + 1 < size && mFScore[mHeap[child + 1]] < mFScore[mHeap[child]])
+                    ++child;
+                if (mFScore[point] <= mFScore[mHeap[child]])
+                    break;
+                place(pos, mHeap[child]);
+                pos = child;
+            }
+            place(pos, point);
+        }
+    };
+
+    // Scratch buffers are per thread so that concurrent searches over the shared
+    // graphs do not race, and are kept between calls to avoid reallocation.
+    AStarScratch& getAStarScratch()
+    {
+        thread_local AStarScratch scratch;
+        return scratch;
+    }
 }
 
 namespace MWMechanics
@@ -236,7 +344,9 @@ namespace MWMechanics
      * Uses mGraph which has pre-computed costs for allowed edges.  It is assumed
      * that mGraph is already constructed.
      *
-     * Should be possible to make this MT safe.
+     * The search state lives in per-thread scratch buffers which are only grown,
+     * never shrunk, so repeated queries do not allocate.  This keeps the method
+     * MT safe as long as the graph itself is not modified.
      *
      * Returns path which may be empty.  path contains pathgrid points in local
      * cell coordinates (indoors) or world coordinates (external).
@@ -245,8 +355,7 @@ namespace MWMechanics
      *   start, goal - pathgrid point indexes (for this cell)
      *
      * Variables:
-     *   openset - point indexes to be traversed, lowest cost at the front
-     *   closedset - point indexes already traversed
+     *   openset - indexed binary heap of point indexes, lowest fScore at the top
      *   gScore - past accumulated costs vector indexed by point index
      *   fScore - future estimated costs vector indexed by point index
      *
@@ -263,62 +372,41 @@ namespace MWMechanics
             return path; // there is no path, return an empty path
         }
 
-        int graphSize = static_cast<int> (mGraph.size());
-        std::vector<float> gScore (graphSize, -1);
-        std::vector<float> fScore (graphSize, -1);
-        std::vector<int> graphParent (graphSize, -1);
+        AStarScratch& scratch = getAStarScratch();
+        scratch.reset(mGraph.size());
 
         // gScore & fScore keep costs for each pathgrid point in mPoints
-        gScore[start] = 0;
-        fScore[start] = costAStar(mPathgrid->mPoints[start], mPathgrid->mPoints[goal]);
-
-        std::list<int> openset;
-        std::list<int> closedset;
-        openset.push_back(start);
+        scratch.mGScore[start] = 0;
+        scratch.push(start, costAStar(mPathgrid->mPoints[start], mPathgrid->mPoints[goal]));
 
         int current = -1;
 
-        while(!openset.empty())
+        while(!scratch.empty())
         {
-            current = openset.front(); // front has the lowest cost
-            openset.pop_front();
+            current = scratch.pop(); // lowest fScore
 
             if(current == goal)
                 break;
 
-            closedset.push_back(current); // remember we've been here
-
             // check all edges for the current point index
-            for(int j = 0; j < static_cast<int> (mGraph[current].edges.size()); j++)
+            for(const ConnectedPoint& edge : mGraph[current].edges)
             {
-                if(std::find(closedset.begin(), closedset.end(), mGraph[current].edges[j].index) ==
-                   closedset.end())
+                const int dest = edge.index;
+                if(scratch.isClosed(dest))
+                    continue; // traversed this edge destination already, try the next edge
+
+                const float tentative_g = scratch.mGScore[current] + edge.cost;
+                const bool isInOpenSet = scratch.isOpen(dest);
+                if(!isInOpenSet || tentative_g < scratch.mGScore[dest])
                 {
-                    // not in closedset - i.e. have not traversed this edge destination
-                    int dest = mGraph[current].edges[j].index;
-                    float tentative_g = gScore[current] + mGraph[current].edges[j].cost;
-                    bool isInOpenSet = std::find(openset.begin(), openset.end(), dest) != openset.end();
-                    if(!isInOpenSet
-                        || tentative_g < gScore[dest])
-                    {
-                        graphParent[dest] = current;
-                        gScore[dest] = tentative_g;
-                        fScore[dest] = tentative_g + costAStar(mPathgrid->mPoints[dest],
-                                                               mPathgrid->mPoints[goal]);
-                        if(!isInOpenSet)
-                        {
-                            // add this edge to openset, lowest cost goes to the front
-                            // TODO: if this causes performance problems a hash table may help
-                            std::list<int>::iterator it = openset.begin();
-                            for(it = openset.begin(); it!= openset.end(); ++it)
-                            {
-                                if(fScore[*it] > fScore[dest])
-                                    break;
-                            }
-                            openset.insert(it, dest);
-                        }
-                    }
-                } // if in closedset, i.e. traversed this edge already, try the next edge
+                    scratch.mParent[dest] = current;
+                    scratch.mGScore[dest] = tentative_g;
+                    const float f = tentative_g + costAStar(mPathgrid->mPoints[dest], mPathgrid->mPoints[goal]);
+                    if(isInOpenSet)
+                        scratch.decrease(dest, f);
+                    else
+                        scratch.push(dest, f);
+                }
             }
         }
 
@@ -326,10 +414,10 @@ namespace MWMechanics
             return path; // for some reason couldn't build a path
 
         // reconstruct path to return, using local coordinates
-        while(graphParent[current] != -1)
+        while(scratch.mParent[current] != -1)
         {
             path.push_front(mPathgrid->mPoints[current]);
-            current = graphParent[current];
+            current = scratch.mParent[current];
         }
 
         // add first node to path explicitly
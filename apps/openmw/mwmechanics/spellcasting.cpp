@@ -252,7 +252,7 @@ namespace MWMechanics
 
                         // Command spells should have their effect, including taking the target out of combat, each time the spell successfully affects the target
                         if (((effectIt->mEffectID == ESM::MagicEffect::CommandHumanoid && target.getClass().isNpc())
-                        || (effectIt->mEffectID == ESM::MagicEffect::CommandCreature && target.getTypeName() == typeid(ESM::Creature).name()))
+                        || (effectIt->mEffectID == ESM::MagicEffect::CommandCreature && target.getType() == MWWorld::RefType::Creature))
                         && !caster.isEmpty() && caster.getClass().isActor() && target != getPlayer() && effect.mMagnitude >= target.getClass().getCreatureStats(target).getLevel())
                         {
                             MWMechanics::AiFollow package(caster, true);
@@ -473,7 +473,7 @@ namespace MWMechanics
 
         bool godmode = mCaster == MWMechanics::getPlayer() && MWBase::Environment::get().getWorld()->getGodModeState();
         bool isProjectile = false;
-        if (item.getTypeName() == typeid(ESM::Weapon).name())
+        if (item.getType() == MWWorld::RefType::Weapon)
         {
             int type = item.get<ESM::Weapon>()->mBase->mData.mType;
             ESM::WeaponType::Class weapclass = MWMechanics::getWeaponType(type)->mWeaponClass;
@@ -99,7 +99,7 @@ namespace MWMechanics
 
     float ratePotion (const MWWorld::Ptr &item, const MWWorld::Ptr& actor)
     {
-        if (item.getTypeName() != typeid(ESM::Potion).name())
+        if (item.getType() != MWWorld::RefType::Potion)
             return 0.f;
 
         const ESM::Potion* potion = item.get<ESM::Potion>()->mBase;
@@ -21,6 +21,8 @@ namespace MWMechanics
 {
     Spells::Spells()
         : mSpellsChanged(false)
+        , mEffectsRevision(0)
+        , mRevision(0)
     {
     }
 
@@ -38,6 +40,7 @@ namespace MWMechanics
     {
         mEffects = MagicEffects();
         mSourcedEffects.clear();
+        ++mEffectsRevision;
 
         for (const auto& iter : mSpells)
         {
@@ -113,6 +116,7 @@ namespace MWMechanics
             params.mEffectRands = random;
             mSpells.emplace(spell, params);
             mSpellsChanged = true;
+            ++mRevision;
         }
     }
 
@@ -133,10 +137,11 @@ namespace MWMechanics
         {
             mSpells.erase(it);
             mSpellsChanged = true;
+            ++mRevision;
         }
     }
 
-    MagicEffects Spells::getMagicEffects() const
+    const MagicEffects& Spells::getMagicEffects() const
     {
         if (mSpellsChanged) {
             rebuildEffects();
@@ -145,10 +150,25 @@ namespace MWMechanics
         return mEffects;
     }
 
+    unsigned int Spells::getEffectsRevision() const
+    {
+        if (mSpellsChanged) {
+            rebuildEffects();
+            mSpellsChanged = false;
+        }
+        return mEffectsRevision;
+    }
+
+    unsigned int Spells::getRevision() const
+    {
+        return mRevision;
+    }
+
     void Spells::removeAllSpells()
     {
         mSpells.clear();
         mSpellsChanged = true;
+        ++mRevision;
     }
 
     void Spells::clear(bool modifyBase)
@@ -216,6 +236,7 @@ namespace MWMechanics
                 mSpells.erase(iter++);
                 purged.push_back(spell->mId);
                 mSpellsChanged = true;
+                ++mRevision;
             }
             else
                 ++iter;
@@ -356,6 +377,7 @@ namespace MWMechanics
             {
                 mSpells[spell].mEffectRands = it->second.mEffectRands;
                 mSpells[spell].mPurgedEffects = it->second.mPurgedEffects;
+                ++mRevision;
 
                 if (it->first == state.mSelectedSpell)
                     mSelectedSpell = it->first;
@@ -39,7 +39,9 @@ namespace MWMechanics
 
             mutable bool mSpellsChanged;
             mutable MagicEffects mEffects;
+            mutable unsigned int mEffectsRevision;
             mutable std::map<const ESM::Spell*, MagicEffects> mSourcedEffects;
+            unsigned int mRevision;
             void rebuildEffects() const;
 
             bool hasDisease(const ESM::Spell::SpellType type) const;
@@ -89,9 +91,15 @@ namespace MWMechanics
             ///< If the spell to be removed is the selected spell, the selected spell will be changed to
             /// no spell (empty string).
 
-            MagicEffects getMagicEffects() const;
+            const MagicEffects& getMagicEffects() const;
             ///< Return sum of magic effects resulting from abilities, blights, deseases and curses.
 
+            unsigned int getEffectsRevision() const;
+            ///< Return a number that changes whenever the result of getMagicEffects() changes.
+
+            unsigned int getRevision() const;
+            ///< Return a number that changes whenever a spell is added or removed.
+
             void clear(bool modifyBase = false);
             ///< Remove all spells of al types.
 
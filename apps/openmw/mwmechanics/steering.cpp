@@ -1,7 +1,7 @@
 #include "steering.hpp"
 
 #include <components/misc/mathutil.hpp>
-#include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include "../mwworld/class.hpp"
 #include "../mwworld/ptr.hpp"
@@ -25,7 +25,7 @@ bool smoothTurn(const MWWorld::Ptr& actor, float targetAngleRadians, int axis, f
         return true;
 
     float limit = getAngularVelocity(actor.getClass().getMaxSpeed(actor)) * MWBase::Environment::get().getFrameDuration();
-    static const bool smoothMovement = Settings::Manager::getBool("smooth movement", "Game");
+    static const Settings::SettingValue<bool> smoothMovement("smooth movement", "Game");
     if (smoothMovement)
         limit *= std::min(absDiff / osg::PI + 0.1, 0.5);
 
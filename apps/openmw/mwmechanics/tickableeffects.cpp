@@ -1,6 +1,6 @@
 #include "tickableeffects.hpp"
 
-#include <components/settings/settings.hpp>
+#include <components/settings/settingvalue.hpp>
 
 #include "../mwbase/environment.hpp"
 #include "../mwbase/windowmanager.hpp"
@@ -106,7 +106,7 @@ namespace MWMechanics
             if (godmode)
                 break;
             int index = effectKey.mId-ESM::MagicEffect::DamageHealth;
-            static const bool uncappedDamageFatigue = Settings::Manager::getBool("uncapped damage fatigue", "Game");
+            static const Settings::SettingValue<bool> uncappedDamageFatigue("uncapped damage fatigue", "Game");
             adjustDynamicStat(creatureStats, index, -magnitude, index == 2 && uncappedDamageFatigue);
             break;
         }
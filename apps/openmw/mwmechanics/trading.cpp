@@ -23,7 +23,7 @@ namespace MWMechanics
         }
 
         // reject if npc is a creature
-        if ( merchant.getTypeName() != typeid(ESM::NPC).name() ) {
+        if ( merchant.getType() != MWWorld::RefType::NPC ) {
             return false;
         }
 
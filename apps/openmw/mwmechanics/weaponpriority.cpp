@@ -21,7 +21,7 @@ namespace MWMechanics
     float rateWeapon (const MWWorld::Ptr &item, const MWWorld::Ptr& actor, const MWWorld::Ptr& enemy, int type,
                       float arrowRating, float boltRating)
     {
-        if (enemy.isEmpty() || item.getTypeName() != typeid(ESM::Weapon).name())
+        if (enemy.isEmpty() || item.getType() != MWWorld::RefType::Weapon)
             return 0.f;
 
         if (item.getClass().hasItemHealth(item) && item.getClass().getItemHealth(item) == 0)
@@ -146,7 +146,7 @@ namespace MWMechanics
 
         MWWorld::InventoryStore& store = actor.getClass().getInventoryStore(actor);
 
-        for (MWWorld::ContainerStoreIterator it = store.begin(); it != store.end(); ++it)
+        for (MWWorld::ContainerStoreIterator it = store.begin(MWWorld::ContainerStore::Type_Weapon); it != store.end(); ++it)
         {
             float rating = rateWeapon(*it, actor, enemy, ammoType);
             if (rating > bestAmmoRating)
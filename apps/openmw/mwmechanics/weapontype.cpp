@@ -23,13 +23,13 @@ namespace MWMechanics
                 *weaptype = ESM::Weapon::HandToHand;
             else
             {
-                const std::string &type = weapon->getTypeName();
-                if(type == typeid(ESM::Weapon).name())
+                MWWorld::RefType type = weapon->getType();
+                if(type == MWWorld::RefType::Weapon)
                 {
                     const MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon->get<ESM::Weapon>();
                     *weaptype = ref->mBase->mData.mType;
                 }
-                else if (type == typeid(ESM::Lockpick).name() || type == typeid(ESM::Probe).name())
+                else if (type == MWWorld::RefType::Lockpick || type == MWWorld::RefType::Probe)
                     *weaptype = ESM::Weapon::PickProbe;
             }
 
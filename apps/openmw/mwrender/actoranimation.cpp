@@ -144,21 +144,21 @@ bool ActorAnimation::updateCarriedLeftVisible(const int weaptype) const
                 const MWWorld::InventoryStore& inv = cls.getInventoryStore(mPtr);
                 const MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
                 const MWWorld::ConstContainerStoreIterator shield = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-                if (shield != inv.end() && shield->getTypeName() == typeid(ESM::Armor).name() && !getShieldMesh(*shield).empty())
+                if (shield != inv.end() && shield->getType() == MWWorld::RefType::Armor && !getShieldMesh(*shield).empty())
                 {
                     if(stats.getDrawState() != MWMechanics::DrawState_Weapon)
                         return false;
 
                     if (weapon != inv.end())
                     {
-                        const std::string &type = weapon->getTypeName();
-                        if(type == typeid(ESM::Weapon).name())
+                        MWWorld::RefType type = weapon->getType();
+                        if(type == MWWorld::RefType::Weapon)
                         {
                             const MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon->get<ESM::Weapon>();
                             ESM::Weapon::Type weaponType = (ESM::Weapon::Type)ref->mBase->mData.mType;
                             return !(MWMechanics::getWeaponType(weaponType)->mFlags & ESM::WeaponType::TwoHanded);
                         }
-                        else if (type == typeid(ESM::Lockpick).name() || type == typeid(ESM::Probe).name())
+                        else if (type == MWWorld::RefType::Lockpick || type == MWWorld::RefType::Probe)
                             return true;
                     }
                 }
@@ -185,7 +185,7 @@ void ActorAnimation::updateHolsteredShield(bool showCarriedLeft)
 
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     MWWorld::ConstContainerStoreIterator shield = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
-    if (shield == inv.end() || shield->getTypeName() != typeid(ESM::Armor).name())
+    if (shield == inv.end() || shield->getType() != MWWorld::RefType::Armor)
         return;
 
     // Can not show holdstered shields with two-handed weapons at all
@@ -193,8 +193,8 @@ void ActorAnimation::updateHolsteredShield(bool showCarriedLeft)
     if(weapon == inv.end())
         return;
 
-    const std::string &type = weapon->getTypeName();
-    if(type == typeid(ESM::Weapon).name())
+    MWWorld::RefType type = weapon->getType();
+    if(type == MWWorld::RefType::Weapon)
     {
         const MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon->get<ESM::Weapon>();
         ESM::Weapon::Type weaponType = (ESM::Weapon::Type)ref->mBase->mData.mType;
@@ -255,17 +255,17 @@ bool ActorAnimation::useShieldAnimations() const
     const MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
     const MWWorld::ConstContainerStoreIterator shield = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedLeft);
     if (weapon != inv.end() && shield != inv.end() &&
-        shield->getTypeName() == typeid(ESM::Armor).name() &&
+        shield->getType() == MWWorld::RefType::Armor &&
         !getShieldMesh(*shield).empty())
     {
-        const std::string &type = weapon->getTypeName();
-        if(type == typeid(ESM::Weapon).name())
+        MWWorld::RefType type = weapon->getType();
+        if(type == MWWorld::RefType::Weapon)
         {
             const MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon->get<ESM::Weapon>();
             ESM::Weapon::Type weaponType = (ESM::Weapon::Type)ref->mBase->mData.mType;
             return !(MWMechanics::getWeaponType(weaponType)->mFlags & ESM::WeaponType::TwoHanded);
         }
-        else if (type == typeid(ESM::Lockpick).name() || type == typeid(ESM::Probe).name())
+        else if (type == MWWorld::RefType::Lockpick || type == MWWorld::RefType::Probe)
             return true;
     }
 
@@ -289,8 +289,8 @@ std::string ActorAnimation::getHolsteredWeaponBoneName(const MWWorld::ConstPtr&
     if(weapon.isEmpty())
         return boneName;
 
-    const std::string &type = weapon.getClass().getTypeName();
-    if(type == typeid(ESM::Weapon).name())
+    MWWorld::RefType type = weapon.getClass().getType();
+    if(type == MWWorld::RefType::Weapon)
     {
         const MWWorld::LiveCellRef<ESM::Weapon> *ref = weapon.get<ESM::Weapon>();
         int weaponType = ref->mBase->mData.mType;
@@ -324,7 +324,7 @@ void ActorAnimation::updateHolsteredWeapon(bool showHolsteredWeapons)
 
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
-    if (weapon == inv.end() || weapon->getTypeName() != typeid(ESM::Weapon).name())
+    if (weapon == inv.end() || weapon->getType() != MWWorld::RefType::Weapon)
         return;
 
     // Since throwing weapons stack themselves, do not show such weapon itself
@@ -398,7 +398,7 @@ void ActorAnimation::updateQuiver()
 
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
-    if(weapon == inv.end() || weapon->getTypeName() != typeid(ESM::Weapon).name())
+    if(weapon == inv.end() || weapon->getType() != MWWorld::RefType::Weapon)
         return;
 
     std::string mesh = weapon->getClass().getModel(*weapon);
@@ -470,7 +470,7 @@ void ActorAnimation::updateQuiver()
 
 void ActorAnimation::itemAdded(const MWWorld::ConstPtr& item, int /*count*/)
 {
-    if (item.getTypeName() == typeid(ESM::Light).name())
+    if (item.getType() == MWWorld::RefType::Light)
     {
         const ESM::Light* light = item.get<ESM::Light>()->mBase;
         if (!(light->mData.mFlags & ESM::Light::Carry))
@@ -485,7 +485,7 @@ void ActorAnimation::itemAdded(const MWWorld::ConstPtr& item, int /*count*/)
     // If the count of equipped ammo or throwing weapon was changed, we should update quiver
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
-    if(weapon == inv.end() || weapon->getTypeName() != typeid(ESM::Weapon).name())
+    if(weapon == inv.end() || weapon->getType() != MWWorld::RefType::Weapon)
         return;
 
     MWWorld::ConstContainerStoreIterator ammo = inv.end();
@@ -501,7 +501,7 @@ void ActorAnimation::itemAdded(const MWWorld::ConstPtr& item, int /*count*/)
 
 void ActorAnimation::itemRemoved(const MWWorld::ConstPtr& item, int /*count*/)
 {
-    if (item.getTypeName() == typeid(ESM::Light).name())
+    if (item.getType() == MWWorld::RefType::Light)
     {
         ItemLightMap::iterator iter = mItemLights.find(item);
         if (iter != mItemLights.end())
@@ -519,7 +519,7 @@ void ActorAnimation::itemRemoved(const MWWorld::ConstPtr& item, int /*count*/)
     // If the count of equipped ammo or throwing weapon was changed, we should update quiver
     const MWWorld::InventoryStore& inv = mPtr.getClass().getInventoryStore(mPtr);
     MWWorld::ConstContainerStoreIterator weapon = inv.getSlot(MWWorld::InventoryStore::Slot_CarriedRight);
-    if(weapon == inv.end() || weapon->getTypeName() != typeid(ESM::Weapon).name())
+    if(weapon == inv.end() || weapon->getType() != MWWorld::RefType::Weapon)
         return;
 
     MWWorld::ConstContainerStoreIterator ammo = inv.end();
@@ -1,5 +1,8 @@
 #include "globalmap.hpp"
 
+#include <algorithm>
+#include <thread>
+
 #include <osg/Image>
 #include <osg/Texture2D>
 #include <osg/Group>
@@ -61,6 +64,20 @@ namespace
     }
 
 
+    osg::ref_ptr<osg::Texture2D> createMapTexture(osg::Image* image)
+    {
+        osg::ref_ptr<osg::Texture2D> texture = new osg::Texture2D;
+        texture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
+        texture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
+        texture->setFilter(osg::Texture::MIN_FILTER, osg::Texture::LINEAR);
+        texture->setFilter(osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
+        texture->setResizeNonPowerOfTwoHint(false);
+        if (image)
+            texture->setImage(image);
+        return texture;
+    }
+
+
     class CameraUpdateGlobalCallback : public osg::NodeCallback
     {
     public:
@@ -97,23 +114,23 @@ namespace
 namespace MWRender
 {
 
+    /// Fills the base and alpha images for a band of cell rows. Bands write disjoint texel rows,
+    /// so any number of them can run concurrently on the same images.
     class CreateMapWorkItem : public SceneUtil::WorkItem
     {
     public:
-        CreateMapWorkItem(int width, int height, int minX, int minY, int maxX, int maxY, int cellSize, const MWWorld::Store<ESM::Land>& landStore)
-            : mWidth(width), mHeight(height), mMinX(minX), mMinY(minY), mMaxX(maxX), mMaxY(maxY), mCellSize(cellSize), mLandStore(landStore)
+        CreateMapWorkItem(osg::Image* image, osg::Image* alphaImage, int minX, int minY, int maxX, int maxY,
+                          int originX, int originY, int cellSize, const MWWorld::Store<ESM::Land>& landStore)
+            : mImage(image), mAlphaImage(alphaImage), mMinX(minX), mMinY(minY), mMaxX(maxX), mMaxY(maxY)
+            , mOriginX(originX), mOriginY(originY), mCellSize(cellSize), mLandStore(landStore)
         {
         }
 
         void doWork() override
         {
-            osg::ref_ptr<osg::Image> image = new osg::Image;
-            image->allocateImage(mWidth, mHeight, 1, GL_RGB, GL_UNSIGNED_BYTE);
-            unsigned char* data = image->data();
-
-            osg::ref_ptr<osg::Image> alphaImage = new osg::Image;
-            alphaImage->allocateImage(mWidth, mHeight, 1, GL_ALPHA, GL_UNSIGNED_BYTE);
-            unsigned char* alphaData = alphaImage->data();
+            const int width = mImage->s();
+            unsigned char* data = mImage->data();
+            unsigned char* alphaData = mAlphaImage->data();
 
             for (int x = mMinX; x <= mMaxX; ++x)
             {
@@ -128,8 +145,8 @@ namespace MWRender
                             int vertexX = static_cast<int>(float(cellX) / float(mCellSize) * 9);
                             int vertexY = static_cast<int>(float(cellY) / float(mCellSize) * 9);
 
-                            int texelX = (x-mMinX) * mCellSize + cellX;
-                            int texelY = (y-mMinY) * mCellSize + cellY;
+                            int texelX = (x-mOriginX) * mCellSize + cellX;
+                            int texelY = (y-mOriginY) * mCellSize + cellY;
 
                             unsigned char r,g,b;
 
@@ -166,63 +183,28 @@ namespace MWRender
                                 b = static_cast<unsigned char>(17 - 12 * y2);
                             }
 
-                            data[texelY * mWidth * 3 + texelX * 3] = r;
-                            data[texelY * mWidth * 3 + texelX * 3+1] = g;
-                            data[texelY * mWidth * 3 + texelX * 3+2] = b;
+                            data[texelY * width * 3 + texelX * 3] = r;
+                            data[texelY * width * 3 + texelX * 3+1] = g;
+                            data[texelY * width * 3 + texelX * 3+2] = b;
 
-                            alphaData[texelY * mWidth+ texelX] = (y2 < 0) ? static_cast<unsigned char>(0) : static_cast<unsigned char>(255);
+                            alphaData[texelY * width + texelX] = (y2 < 0) ? static_cast<unsigned char>(0) : static_cast<unsigned char>(255);
                         }
                     }
                 }
             }
-
-            mBaseTexture = new osg::Texture2D;
-            mBaseTexture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
-            mBaseTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
-            mBaseTexture->setFilter(osg::Texture::MIN_FILTER, osg::Texture::LINEAR);
-            mBaseTexture->setFilter(osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
-            mBaseTexture->setImage(image);
-            mBaseTexture->setResizeNonPowerOfTwoHint(false);
-
-            mAlphaTexture = new osg::Texture2D;
-            mAlphaTexture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
-            mAlphaTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
-            mAlphaTexture->setFilter(osg::Texture::MIN_FILTER, osg::Texture::LINEAR);
-            mAlphaTexture->setFilter(osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
-            mAlphaTexture->setImage(alphaImage);
-            mAlphaTexture->setResizeNonPowerOfTwoHint(false);
-
-            mOverlayImage = new osg::Image;
-            mOverlayImage->allocateImage(mWidth, mHeight, 1, GL_RGBA, GL_UNSIGNED_BYTE);
-            assert(mOverlayImage->isDataContiguous());
-
-            memset(mOverlayImage->data(), 0, mOverlayImage->getTotalSizeInBytes());
-
-            mOverlayTexture = new osg::Texture2D;
-            mOverlayTexture->setWrap(osg::Texture::WRAP_S, osg::Texture::CLAMP_TO_EDGE);
-            mOverlayTexture->setWrap(osg::Texture::WRAP_T, osg::Texture::CLAMP_TO_EDGE);
-            mOverlayTexture->setFilter(osg::Texture::MIN_FILTER, osg::Texture::LINEAR);
-            mOverlayTexture->setFilter(osg::Texture::MAG_FILTER, osg::Texture::LINEAR);
-            mOverlayTexture->setResizeNonPowerOfTwoHint(false);
-            mOverlayTexture->setInternalFormat(GL_RGBA);
-            mOverlayTexture->setTextureSize(mWidth, mHeight);
         }
 
-        int mWidth, mHeight;
+    private:
+        osg::ref_ptr<osg::Image> mImage;
+        osg::ref_ptr<osg::Image> mAlphaImage;
         int mMinX, mMinY, mMaxX, mMaxY;
+        int mOriginX, mOriginY;
         int mCellSize;
         const MWWorld::Store<ESM::Land>& mLandStore;
-
-        osg::ref_ptr<osg::Texture2D> mBaseTexture;
-        osg::ref_ptr<osg::Texture2D> mAlphaTexture;
-
-        osg::ref_ptr<osg::Image> mOverlayImage;
-        osg::ref_ptr<osg::Texture2D> mOverlayTexture;
     };
 
-    GlobalMap::GlobalMap(osg::Group* root, SceneUtil::WorkQueue* workQueue)
+    GlobalMap::GlobalMap(osg::Group* root)
         : mRoot(root)
-        , mWorkQueue(workQueue)
         , mWidth(0)
         , mHeight(0)
         , mMinX(0), mMaxX(0)
@@ -239,8 +221,8 @@ namespace MWRender
         for (auto& camera : mActiveCameras)
             removeCamera(camera);
 
-        if (mWorkItem)
-            mWorkItem->waitTillDone();
+        for (const auto& workItem : mWorkItems)
+            workItem->waitTillDone();
     }
 
     void GlobalMap::render ()
@@ -265,8 +247,29 @@ namespace MWRender
         mWidth = mCellSize*(mMaxX-mMinX+1);
         mHeight = mCellSize*(mMaxY-mMinY+1);
 
-        mWorkItem = new CreateMapWorkItem(mWidth, mHeight, mMinX, mMinY, mMaxX, mMaxY, mCellSize, esmStore.get<ESM::Land>());
-        mWorkQueue->addWorkItem(mWorkItem);
+        osg::ref_ptr<osg::Image> image = new osg::Image;
+        image->allocateImage(mWidth, mHeight, 1, GL_RGB, GL_UNSIGNED_BYTE);
+
+        osg::ref_ptr<osg::Image> alphaImage = new osg::Image;
+        alphaImage->allocateImage(mWidth, mHeight, 1, GL_ALPHA, GL_UNSIGNED_BYTE);
+
+        mBaseTexture = createMapTexture(image);
+        mAlphaTexture = createMapTexture(alphaImage);
+
+        // Split the map into bands of cell rows and generate them on a queue of its own, using every core.
+        // The threads are released again once the map is loaded.
+        if (!mWorkQueue)
+            mWorkQueue = new SceneUtil::WorkQueue(std::max(1u, std::thread::hardware_concurrency()));
+
+        const int rowsPerBand = 16;
+        for (int minY = mMinY; minY <= mMaxY; minY += rowsPerBand)
+        {
+            int maxY = std::min(minY + rowsPerBand - 1, mMaxY);
+            osg::ref_ptr<CreateMapWorkItem> workItem = new CreateMapWorkItem(image, alphaImage, mMinX, minY, mMaxX, maxY,
+                                                                             mMinX, mMinY, mCellSize, esmStore.get<ESM::Land>());
+            mWorkQueue->addWorkItem(workItem);
+            mWorkItems.push_back(workItem);
+        }
     }
 
     void GlobalMap::worldPosToImageSpace(float x, float z, float& imageX, float& imageY)
@@ -552,19 +555,25 @@ namespace MWRender
 
     void GlobalMap::ensureLoaded()
     {
-        if (mWorkItem)
-        {
-            mWorkItem->waitTillDone();
+        if (mWorkItems.empty())
+            return;
 
-            mOverlayImage = mWorkItem->mOverlayImage;
-            mBaseTexture = mWorkItem->mBaseTexture;
-            mAlphaTexture = mWorkItem->mAlphaTexture;
-            mOverlayTexture = mWorkItem->mOverlayTexture;
+        for (const auto& workItem : mWorkItems)
+            workItem->waitTillDone();
+        mWorkItems.clear();
+        mWorkQueue = nullptr;
 
-            requestOverlayTextureUpdate(0, 0, mWidth, mHeight, osg::ref_ptr<osg::Texture2D>(), true, false);
+        mOverlayImage = new osg::Image;
+        mOverlayImage->allocateImage(mWidth, mHeight, 1, GL_RGBA, GL_UNSIGNED_BYTE);
+        assert(mOverlayImage->isDataContiguous());
 
-            mWorkItem = nullptr;
-        }
+        memset(mOverlayImage->data(), 0, mOverlayImage->getTotalSizeInBytes());
+
+        mOverlayTexture = createMapTexture(nullptr);
+        mOverlayTexture->setInternalFormat(GL_RGBA);
+        mOverlayTexture->setTextureSize(mWidth, mHeight);
+
+        requestOverlayTextureUpdate(0, 0, mWidth, mHeight, osg::ref_ptr<osg::Texture2D>(), true, false);
     }
 
     bool GlobalMap::copyResult(osg::Camera *camera, unsigned int frame)
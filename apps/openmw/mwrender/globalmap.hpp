@@ -33,7 +33,7 @@ namespace MWRender
     class GlobalMap
     {
     public:
-        GlobalMap(osg::Group* root, SceneUtil::WorkQueue* workQueue);
+        GlobalMap(osg::Group* root);
         ~GlobalMap();
 
         void render();
@@ -124,7 +124,7 @@ namespace MWRender
         osg::ref_ptr<osg::Image> mOverlayImage;
 
         osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
-        osg::ref_ptr<CreateMapWorkItem> mWorkItem;
+        std::vector<osg::ref_ptr<CreateMapWorkItem>> mWorkItems;
 
         int mWidth;
         int mHeight;
@@ -2,6 +2,9 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include <osg/Fog>
 #include <osg/LightModel>
 #include <osg/Texture2D>
@@ -72,6 +75,7 @@ namespace MWRender
 
 LocalMap::LocalMap(osg::Group* root)
     : mRoot(root)
+    , mSegmentsPerFrame(std::max(0, Settings::Manager::getInt("local map segments per frame", "Map")))
     , mMapResolution(Settings::Manager::getInt("local map resolution", "Map"))
     , mMapWorldSize(Constants::CellSizeInUnits)
     , mCellDistance(Constants::CellGridRadius)
@@ -107,6 +111,7 @@ const osg::Vec2f LocalMap::rotatePoint(const osg::Vec2f& point, const osg::Vec2f
 void LocalMap::clear()
 {
     mSegments.clear();
+    mQueuedCameras.clear();
 }
 
 void LocalMap::saveFogOfWar(MWWorld::CellStore* cell)
@@ -223,7 +228,7 @@ osg::ref_ptr<osg::Camera> LocalMap::createOrthographicCamera(float x, float y, f
     return camera;
 }
 
-void LocalMap::setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int y)
+void LocalMap::setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int y, bool queued)
 {
     osg::ref_ptr<osg::Texture2D> texture (new osg::Texture2D);
     texture->setTextureSize(mMapResolution, mMapResolution);
@@ -235,14 +240,33 @@ void LocalMap::setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int
 
     camera->attach(osg::Camera::COLOR_BUFFER, texture);
 
-    camera->addChild(mSceneRoot);
-    mRoot->addChild(camera);
-    mActiveCameras.push_back(camera);
+    if (queued && mSegmentsPerFrame > 0)
+    {
+        // The texture is handed out right away, make sure it doesn't show garbage until the segment is rendered
+        if (!mBlankImage)
+        {
+            mBlankImage = new osg::Image;
+            mBlankImage->allocateImage(mMapResolution, mMapResolution, 1, GL_RGB, GL_UNSIGNED_BYTE);
+            std::memset(mBlankImage->data(), 0, mBlankImage->getTotalSizeInBytes());
+        }
+        texture->setImage(mBlankImage);
+        texture->setUnRefImageDataAfterApply(true);
+        mQueuedCameras.push_back(camera);
+    }
+    else
+        addCamera(camera);
 
     MapSegment& segment = mSegments[std::make_pair(x, y)];
     segment.mMapTexture = texture;
 }
 
+void LocalMap::addCamera(osg::ref_ptr<osg::Camera> camera)
+{
+    camera->addChild(mSceneRoot);
+    mRoot->addChild(camera);
+    mActiveCameras.push_back(camera);
+}
+
 bool needUpdate(std::set<std::pair<int, int> >& renderedGrid, std::set<std::pair<int, int> >& currentGrid, int cellX, int cellY)
 {
     // if all the cells of the current grid are contained in the rendered grid then we can keep the old render
@@ -296,7 +320,10 @@ void LocalMap::removeCell(MWWorld::CellStore *cell)
         mCurrentGrid.erase(coords);
     }
     else
+    {
         mSegments.clear();
+        mQueuedCameras.clear();
+    }
 }
 
 osg::ref_ptr<osg::Texture2D> LocalMap::getMapTexture(int x, int y)
@@ -337,13 +364,16 @@ void LocalMap::markForRemoval(osg::Camera *cam)
 
 void LocalMap::cleanupCameras()
 {
-    if (mCamerasPendingRemoval.empty())
-        return;
-
     for (auto& camera : mCamerasPendingRemoval)
         removeCamera(camera);
 
     mCamerasPendingRemoval.clear();
+
+    for (std::size_t i = 0; i < mSegmentsPerFrame && !mQueuedCameras.empty(); ++i)
+    {
+        addCamera(mQueuedCameras.front());
+        mQueuedCameras.pop_front();
+    }
 }
 
 void LocalMap::requestExteriorMap(const MWWorld::CellStore* cell)
@@ -359,7 +389,7 @@ void LocalMap::requestExteriorMap(const MWWorld::CellStore* cell)
 
     osg::ref_ptr<osg::Camera> camera = createOrthographicCamera(x*mMapWorldSize + mMapWorldSize/2.f, y*mMapWorldSize + mMapWorldSize/2.f, mMapWorldSize, mMapWorldSize,
                                                                 osg::Vec3d(0,1,0), zmin, zmax);
-    setupRenderToTexture(camera, cell->getCell()->getGridX(), cell->getCell()->getGridY());
+    setupRenderToTexture(camera, cell->getCell()->getGridX(), cell->getCell()->getGridY(), false);
 
     MapSegment& segment = mSegments[std::make_pair(cell->getCell()->getGridX(), cell->getCell()->getGridY())];
     if (!segment.mFogOfWarImage)
@@ -388,6 +418,9 @@ void LocalMap::requestInteriorMap(const MWWorld::CellStore* cell)
 
     mBounds = bounds;
 
+    // all segments are requested again, possibly with different bounds
+    mQueuedCameras.clear();
+
     // Get the cell's NorthMarker rotation. This is used to rotate the entire map.
     osg::Vec2f north = MWBase::Environment::get().getWorld()->getNorthVector(cell);
 
@@ -481,7 +514,7 @@ void LocalMap::requestInteriorMap(const MWWorld::CellStore* cell)
                                                                         mMapWorldSize, mMapWorldSize,
                                                                         osg::Vec3f(north.x(), north.y(), 0.f), zMin, zMax);
 
-            setupRenderToTexture(camera, x, y);
+            setupRenderToTexture(camera, x, y, true);
 
             MapSegment& segment = mSegments[std::make_pair(x,y)];
             if (!segment.mFogOfWarImage)
@@ -1,6 +1,7 @@
 #ifndef GAME_RENDER_LOCALMAP_H
 #define GAME_RENDER_LOCALMAP_H
 
+#include <deque>
 #include <set>
 #include <vector>
 #include <map>
@@ -65,9 +66,9 @@ namespace MWRender
         void markForRemoval(osg::Camera* cam);
 
         /**
-         * Removes cameras that have already been rendered. Should be called every frame to ensure that
-         * we do not render the same map more than once. Note, this cleanup is difficult to implement in an
-         * automated fashion, since we can't alter the scene graph structure from within an update callback.
+         * Removes cameras that have already been rendered and adds the next queued interior map segments to the scene.
+         * Should be called every frame to ensure that we do not render the same map more than once. Note, this cleanup
+         * is difficult to implement in an automated fashion, since we can't alter the scene graph structure from within an update callback.
          */
         void cleanupCameras();
 
@@ -109,6 +110,12 @@ namespace MWRender
 
         CameraVector mCamerasPendingRemoval;
 
+        // interior map segments waiting to be rendered, at most mSegmentsPerFrame are added to the scene per frame
+        std::deque<osg::ref_ptr<osg::Camera>> mQueuedCameras;
+        std::size_t mSegmentsPerFrame;
+        // shown by queued segments until they are rendered
+        osg::ref_ptr<osg::Image> mBlankImage;
+
         typedef std::set<std::pair<int, int> > Grid;
         Grid mCurrentGrid;
 
@@ -151,7 +158,8 @@ namespace MWRender
         void requestInteriorMap(const MWWorld::CellStore* cell);
 
         osg::ref_ptr<osg::Camera> createOrthographicCamera(float left, float top, float width, float height, const osg::Vec3d& upVector, float zmin, float zmax);
-        void setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int y);
+        void setupRenderToTexture(osg::ref_ptr<osg::Camera> camera, int x, int y, bool queued);
+        void addCamera(osg::ref_ptr<osg::Camera> camera);
 
         bool mInterior;
         osg::BoundingBox mBounds;
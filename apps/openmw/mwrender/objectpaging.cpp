@@ -14,6 +14,7 @@
 #include <components/resource/scenemanager.hpp>
 #include <components/sceneutil/optimizer.hpp>
 #include <components/sceneutil/clone.hpp>
+#include <components/sceneutil/instancing.hpp>
 #include <components/sceneutil/util.hpp>
 #include <components/vfs/manager.hpp>
 
@@ -35,6 +36,9 @@
 namespace MWRender
 {
 
+    // Fewer references are cheaper to draw with their own transforms than to set up instance arrays for
+    const std::size_t sMinInstancesToInstance = 4;
+
     bool typeFilter(int type, bool far)
     {
         switch (type)
@@ -366,6 +370,8 @@ namespace MWRender
     {
         mActiveGrid = Settings::Manager::getBool("object paging active grid", "Terrain");
         mDebugBatches = Settings::Manager::getBool("object paging debug batches", "Terrain");
+        // The instance matrices are only read by the object shaders
+        mInstancing = Settings::Manager::getBool("object paging instancing", "Terrain") && sceneManager->getForceShaders();
         mMergeFactor = Settings::Manager::getFloat("object paging merge factor", "Terrain");
         mMinSize = Settings::Manager::getFloat("object paging min size", "Terrain");
         mMinSizeMergeFactor = Settings::Manager::getFloat("object paging min size merge factor", "Terrain");
@@ -549,6 +555,12 @@ namespace MWRender
             if (minSizeMergeFactor2 > 0)
                 minSizeMerged *= minSizeMergeFactor2;
 
+            // Templates not worth merging can still be drawn with one call per geometry instead of one per reference.
+            // Active cells are excluded, there references need their own nodes to be picked or disabled.
+            const bool instance = !merge && !activeGrid && mInstancing
+                && pair.second.mInstances.size() >= sMinInstancesToInstance && SceneUtil::canInstance(*cnode);
+            std::vector<osg::Matrixf> instanceMatrices;
+
             unsigned int numinstances = 0;
             for (auto cref : pair.second.mInstances)
             {
@@ -564,6 +576,14 @@ namespace MWRender
                                         osg::Quat(ref.mPos.rot[1], osg::Vec3f(0,-1,0)) *
                                         osg::Quat(ref.mPos.rot[0], osg::Vec3f(-1,0,0)) );
                 matrix.preMultScale(osg::Vec3f(ref.mScale, ref.mScale, ref.mScale));
+
+                if (instance)
+                {
+                    instanceMatrices.push_back(matrix);
+                    ++numinstances;
+                    continue;
+                }
+
                 osg::ref_ptr<osg::MatrixTransform> trans = new osg::MatrixTransform(matrix);
                 trans->setDataVariance(osg::Object::STATIC);
 
@@ -593,6 +613,16 @@ namespace MWRender
                 attachTo->addChild(trans);
                 ++numinstances;
             }
+            if (!instanceMatrices.empty())
+            {
+                osg::ref_ptr<osg::Node> instances = SceneUtil::createInstances(*cnode, instanceMatrices);
+                if (compile)
+                {
+                    stateToCompile._mode = osgUtil::GLObjectsVisitor::COMPILE_DISPLAY_LISTS;
+                    instances->accept(stateToCompile);
+                }
+                group->addChild(instances);
+            }
             if (numinstances > 0)
             {
                 // add a ref to the original template, to hint to the cache that it's still being used and should be kept in cache
@@ -53,6 +53,7 @@ namespace MWRender
         Resource::SceneManager* mSceneManager;
         bool mActiveGrid;
         bool mDebugBatches;
+        bool mInstancing;
         float mMergeFactor;
         float mMinSize;
         float mMinSizeMergeFactor;
@@ -1,5 +1,6 @@
 #include "renderingmanager.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <cstdlib>
 #include <condition_variable>
@@ -22,6 +23,9 @@
 
 #include <osgViewer/Viewer>
 
+#include <boost/filesystem/fstream.hpp>
+
+
 #include <components/nifosg/nifloader.hpp>
 
 #include <components/debug/debuglog.hpp>
@@ -47,6 +51,7 @@
 
 #include <components/terrain/terraingrid.hpp>
 #include <components/terrain/quadtreeworld.hpp>
+#include <components/terrain/vertexcache.hpp>
 
 #include <components/esm/loadcell.hpp>
 #include <components/fallback/fallback.hpp>
@@ -373,6 +378,8 @@ namespace MWRender
         mRootNode->getOrCreateStateSet()->addUniform(new osg::Uniform("near", mNearClip));
         mRootNode->getOrCreateStateSet()->addUniform(new osg::Uniform("far", mViewDistance));
         mRootNode->getOrCreateStateSet()->addUniform(new osg::Uniform("simpleWater", false));
+        // Only set by the stateset of instanced paged objects, see SceneUtil::createInstances()
+        mRootNode->getOrCreateStateSet()->addUniform(new osg::Uniform("useInstancing", false));
 
         mUniformNear = mRootNode->getOrCreateStateSet()->getUniform("near");
         mUniformFar = mRootNode->getOrCreateStateSet()->getUniform("far");
@@ -433,6 +440,40 @@ namespace MWRender
         mWorkQueue->addWorkItem(workItem);
     }
 
+    void RenderingManager::loadTerrainVertexCache(const std::string& path, const std::vector<std::string>& contentFilePaths)
+    {
+        try
+        {
+            auto stream = std::make_unique<boost::filesystem::ifstream>(boost::filesystem::path(path), std::ios::binary);
+            if (!*stream)
+                throw std::runtime_error("Failed to open file");
+
+            std::shared_ptr<Terrain::VertexCache> cache = std::make_shared<Terrain::VertexCache>();
+            cache->open(std::move(stream));
+
+            std::vector<Terrain::VertexCache::ContentFile> contentFiles;
+            for (const std::string& file : contentFilePaths)
+                contentFiles.push_back(Terrain::VertexCache::ContentFile::fromPath(file));
+
+            try
+            {
+                cache->validate(contentFiles, Settings::Manager::getInt("vertex lod mod", "Terrain"));
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Warning) << "Warning: Terrain vertex cache " << path << " was " << e.what() << ", ignoring it";
+                return;
+            }
+
+            mTerrainStorage->setVertexCache(cache);
+            Log(Debug::Info) << "Using " << cache->getNumChunks() << " terrain chunks from " << path;
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Error) << "Error: Failed to load terrain vertex cache " << path << ": " << e.what();
+        }
+    }
+
     double RenderingManager::getReferenceTime() const
     {
         return mViewer->getFrameStamp()->getReferenceTime();
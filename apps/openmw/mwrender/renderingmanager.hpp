@@ -111,6 +111,11 @@ namespace MWRender
 
         void preloadCommonAssets();
 
+        /// Use terrain vertex data generated by the terrainbake tool, if it was made for these content files.
+        /// @param path The 'prebaked vertex cache' setting
+        /// @param contentFilePaths Full paths of the loaded content files, in load order
+        void loadTerrainVertexCache(const std::string& path, const std::vector<std::string>& contentFilePaths);
+
         double getReferenceTime() const;
 
         osg::Group* getLightRoot();
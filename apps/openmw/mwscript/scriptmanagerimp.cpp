@@ -16,19 +16,103 @@
 #include <components/compiler/exception.hpp>
 #include <components/compiler/quickfileparser.hpp>
 
+#include <components/sceneutil/workqueue.hpp>
+
 #include "../mwworld/esmstore.hpp"
 
 #include "extensions.hpp"
 #include "interpretercontext.hpp"
 
+namespace
+{
+    bool compileScript (const ESM::Script& script, const std::string& name, Compiler::FileParser& parser,
+        Compiler::StreamErrorHandler& errorHandler, const Compiler::Context& context)
+    {
+        parser.reset();
+        errorHandler.reset();
+        errorHandler.setContext(name);
+
+        bool Success = true;
+        try
+        {
+            std::istringstream input (script.mScriptText);
+
+            Compiler::Scanner scanner (errorHandler, input, context.getExtensions());
+
+            scanner.scan (parser);
+
+            if (!errorHandler.isGood())
+                Success = false;
+        }
+        catch (const Compiler::SourceException&)
+        {
+            // error has already been reported via error handler
+            Success = false;
+        }
+        catch (const std::exception& error)
+        {
+            Log(Debug::Error) << "Error: An exception has been thrown: " << error.what();
+            Success = false;
+        }
+
+        if (!Success)
+        {
+            Log(Debug::Error) << "Error: script compiling failed: " << name;
+        }
+
+        return Success;
+    }
+
+    /// Compiles a batch of scripts with its own parser, so that several batches can be compiled at the same time.
+    class CompileScriptsWorkItem : public SceneUtil::WorkItem
+    {
+    public:
+        struct Result
+        {
+            const ESM::Script* mScript;
+            bool mSuccess;
+            std::vector<Interpreter::Type_Code> mByteCode;
+            Compiler::Locals mLocals;
+        };
+
+        CompileScriptsWorkItem (std::vector<Result> scripts, Compiler::Context& context, int warningsMode)
+            : mResults (std::move(scripts)), mContext (context), mWarningsMode (warningsMode)
+        {
+        }
+
+        void doWork() override
+        {
+            Compiler::StreamErrorHandler errorHandler;
+            errorHandler.setWarningsMode (mWarningsMode);
+            Compiler::FileParser parser (errorHandler, mContext);
+
+            for (Result& result : mResults)
+            {
+                result.mSuccess = compileScript (*result.mScript, result.mScript->mId, parser, errorHandler, mContext);
+                if (result.mSuccess)
+                {
+                    parser.getCode (result.mByteCode);
+                    result.mLocals = parser.getLocals();
+                }
+            }
+        }
+
+        std::vector<Result> mResults;
+
+    private:
+        Compiler::Context& mContext;
+        int mWarningsMode;
+    };
+}
+
 namespace MWScript
 {
     ScriptManager::ScriptManager (const MWWorld::ESMStore& store,
         Compiler::Context& compilerContext, int warningsMode,
-        const std::vector<std::string>& scriptBlacklist)
+        const std::vector<std::string>& scriptBlacklist, SceneUtil::WorkQueue* workQueue)
     : mErrorHandler(), mStore (store),
       mCompilerContext (compilerContext), mParser (mErrorHandler, mCompilerContext),
-      mOpcodesInstalled (false), mGlobalScripts (store)
+      mOpcodesInstalled (false), mWarningsMode (warningsMode), mWorkQueue (workQueue), mGlobalScripts (store)
     {
         mErrorHandler.setWarningsMode (warningsMode);
 
@@ -39,44 +123,13 @@ namespace MWScript
         std::sort (mScriptBlacklist.begin(), mScriptBlacklist.end());
     }
 
+    ScriptManager::~ScriptManager() = default;
+
     bool ScriptManager::compile (const std::string& name)
     {
-        mParser.reset();
-        mErrorHandler.reset();
-
         if (const ESM::Script *script = mStore.get<ESM::Script>().find (name))
         {
-            mErrorHandler.setContext(name);
-
-            bool Success = true;
-            try
-            {
-                std::istringstream input (script->mScriptText);
-
-                Compiler::Scanner scanner (mErrorHandler, input, mCompilerContext.getExtensions());
-
-                scanner.scan (mParser);
-
-                if (!mErrorHandler.isGood())
-                    Success = false;
-            }
-            catch (const Compiler::SourceException&)
-            {
-                // error has already been reported via error handler
-                Success = false;
-            }
-            catch (const std::exception& error)
-            {
-                Log(Debug::Error) << "Error: An exception has been thrown: " << error.what();
-                Success = false;
-            }
-
-            if (!Success)
-            {
-                Log(Debug::Error) << "Error: script compiling failed: " << name;
-            }
-
-            if (Success)
+            if (compileScript (*script, name, mParser, mErrorHandler, mCompilerContext))
             {
                 std::vector<Interpreter::Type_Code> code;
                 mParser.getCode(code);
@@ -149,15 +202,72 @@ namespace MWScript
         int count = 0;
         int success = 0;
 
+        if (!mWorkQueue)
+        {
+            for (auto& script : mStore.get<ESM::Script>())
+            {
+                if (!std::binary_search (mScriptBlacklist.begin(), mScriptBlacklist.end(),
+                    Misc::StringUtils::lowerCase(script.mId)))
+                {
+                    ++count;
+
+                    if (compile(script.mId))
+                        ++success;
+                }
+            }
+
+            return std::make_pair (count, success);
+        }
+
+        // Split the scripts into batches. Only the workers touch the compiler until all batches are done,
+        // results are added to mScripts afterwards.
+        const std::size_t batchSize = 32;
+        std::vector<osg::ref_ptr<CompileScriptsWorkItem>> workItems;
+        std::vector<CompileScriptsWorkItem::Result> batch;
+
         for (auto& script : mStore.get<ESM::Script>())
         {
-            if (!std::binary_search (mScriptBlacklist.begin(), mScriptBlacklist.end(),
+            if (mScripts.find (script.mId) != mScripts.end())
+                continue;
+
+            if (std::binary_search (mScriptBlacklist.begin(), mScriptBlacklist.end(),
                 Misc::StringUtils::lowerCase(script.mId)))
+                continue;
+
+            batch.push_back ({&script, false, {}, {}});
+
+            if (batch.size() == batchSize)
+            {
+                workItems.push_back (new CompileScriptsWorkItem (std::move(batch), mCompilerContext, mWarningsMode));
+                batch.clear();
+            }
+        }
+
+        if (!batch.empty())
+            workItems.push_back (new CompileScriptsWorkItem (std::move(batch), mCompilerContext, mWarningsMode));
+
+        for (const auto& workItem : workItems)
+            mWorkQueue->addWorkItem (workItem);
+
+        for (const auto& workItem : workItems)
+            workItem->waitTillDone();
+
+        for (const auto& workItem : workItems)
+        {
+            for (auto& result : workItem->mResults)
             {
                 ++count;
 
-                if (compile(script.mId))
+                if (result.mSuccess)
+                {
                     ++success;
+                    mScripts.emplace (result.mScript->mId, CompiledScript (result.mByteCode, result.mLocals));
+                }
+                else
+                {
+                    // same as a failed compile in run(), so that the errors are not reported again
+                    mScripts.emplace (result.mScript->mId, CompiledScript (std::vector<Interpreter::Type_Code>(), Compiler::Locals()));
+                }
             }
         }
 
@@ -176,6 +286,8 @@ namespace MWScript
         }
 
         {
+            std::lock_guard<std::mutex> lock (mLocalsMutex);
+
             std::map<std::string, Compiler::Locals>::iterator iter = mOtherLocals.find (name2);
 
             if (iter!=mOtherLocals.end())
@@ -186,13 +298,18 @@ namespace MWScript
         {
             Compiler::Locals locals;
 
-            const Compiler::ContextOverride override(mErrorHandler, name2 + "[local variables]");
+            // not using mErrorHandler, since this may be called by several compiler threads at once
+            Compiler::StreamErrorHandler errorHandler;
+            errorHandler.setWarningsMode (mWarningsMode);
+            errorHandler.setContext (name2 + "[local variables]");
 
             std::istringstream stream (script->mScriptText);
-            Compiler::QuickFileParser parser (mErrorHandler, mCompilerContext, locals);
-            Compiler::Scanner scanner (mErrorHandler, stream, mCompilerContext.getExtensions());
+            Compiler::QuickFileParser parser (errorHandler, mCompilerContext, locals);
+            Compiler::Scanner scanner (errorHandler, stream, mCompilerContext.getExtensions());
             scanner.scan (parser);
 
+            std::lock_guard<std::mutex> lock (mLocalsMutex);
+
             std::map<std::string, Compiler::Locals>::iterator iter =
                 mOtherLocals.emplace(name2, locals).first;
 
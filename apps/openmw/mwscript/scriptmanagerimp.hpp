@@ -2,8 +2,11 @@
 #define GAME_SCRIPT_SCRIPTMANAGER_H
 
 #include <map>
+#include <mutex>
 #include <string>
 
+#include <osg/ref_ptr>
+
 #include <components/compiler/streamerrorhandler.hpp>
 #include <components/compiler/fileparser.hpp>
 
@@ -30,6 +33,11 @@ namespace Interpreter
     class Interpreter;
 }
 
+namespace SceneUtil
+{
+    class WorkQueue;
+}
+
 namespace MWScript
 {
     class ScriptManager : public MWBase::ScriptManager
@@ -40,6 +48,8 @@ namespace MWScript
             Compiler::FileParser mParser;
             Interpreter::Interpreter mInterpreter;
             bool mOpcodesInstalled;
+            int mWarningsMode;
+            osg::ref_ptr<SceneUtil::WorkQueue> mWorkQueue;
 
             struct CompiledScript
             {
@@ -62,11 +72,17 @@ namespace MWScript
             std::map<std::string, Compiler::Locals> mOtherLocals;
             std::vector<std::string> mScriptBlacklist;
 
+            // Guards mOtherLocals, which is also accessed by compileAll() worker threads through getLocals()
+            std::mutex mLocalsMutex;
+
         public:
 
+            /// @param workQueue Used by compileAll() to compile on several threads. May be nullptr.
             ScriptManager (const MWWorld::ESMStore& store,
                 Compiler::Context& compilerContext, int warningsMode,
-                const std::vector<std::string>& scriptBlacklist);
+                const std::vector<std::string>& scriptBlacklist, SceneUtil::WorkQueue* workQueue = nullptr);
+
+            ~ScriptManager();
 
             void clear() override;
 
@@ -78,11 +94,13 @@ namespace MWScript
             /// \return Success?
 
             std::pair<int, int> compileAll() override;
-            ///< Compile all scripts
+            ///< Compile all scripts. Blocks until done, but uses the threads of the work queue if there is one.
+            /// Scripts that failed to compile are not compiled again when run.
             /// \return count, success
 
             const Compiler::Locals& getLocals (const std::string& name) override;
             ///< Return locals for script \a name.
+            /// \note Thread safe while compileAll() is running.
 
             GlobalScripts& getGlobalScripts() override;
     };
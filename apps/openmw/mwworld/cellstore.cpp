@@ -492,45 +492,19 @@ namespace MWWorld
 
     void CellStore::listRefs()
     {
-        std::vector<ESM::ESMReader>& esm = mReader;
-
         assert (mCell);
 
         if (mCell->mContextList.empty())
             return; // this is a dynamically generated cell -> skipping.
 
-        // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < mCell->mContextList.size(); i++)
+        // References from all plugins that do something with this cell.
+        for (const CachedCellRef& ref : *mStore.getCellRefs(*mCell, mReader))
         {
-            try
-            {
-                // Reopen the ESM reader and seek to the right position.
-                int index = mCell->mContextList.at(i).index;
-                mCell->restore (esm[index], i);
-
-                ESM::CellRef ref;
-
-                // Get each reference in turn
-                bool deleted = false;
-                while (mCell->getNextRef (esm[index], ref, deleted))
-                {
-                    if (deleted)
-                        continue;
-
-                    // Don't list reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter =
-                        std::find(mCell->mMovedRefs.begin(), mCell->mMovedRefs.end(), ref.mRefNum);
-                    if (iter != mCell->mMovedRefs.end()) {
-                        continue;
-                    }
+            // Don't list reference if it was moved to a different cell.
+            if (ref.mDeleted || ref.mMoved)
+                continue;
 
-                    mIds.push_back (Misc::StringUtils::lowerCase (ref.mRefID));
-                }
-            }
-            catch (std::exception& e)
-            {
-                Log(Debug::Error) << "An error occurred listing references for cell " << getCell()->getDescription() << ": " << e.what();
-            }
+            mIds.push_back (ref.mLowerCaseRefId);
         }
 
         // List moved references, from separately tracked list.
@@ -548,8 +522,6 @@ namespace MWWorld
 
     void CellStore::loadRefs()
     {
-        std::vector<ESM::ESMReader>& esm = mReader;
-
         assert (mCell);
 
         if (mCell->mContextList.empty())
@@ -558,35 +530,14 @@ namespace MWWorld
         std::map<ESM::RefNum, std::string> refNumToID; // used to detect refID modifications
 
         // Load references from all plugins that do something with this cell.
-        for (size_t i = 0; i < mCell->mContextList.size(); i++)
+        for (const CachedCellRef& cachedRef : *mStore.getCellRefs(*mCell, mReader))
         {
-            try
-            {
-                // Reopen the ESM reader and seek to the right position.
-                int index = mCell->mContextList.at(i).index;
-                mCell->restore (esm[index], i);
-
-                ESM::CellRef ref;
-                ref.mRefNum.mContentFile = ESM::RefNum::RefNum_NoContentFile;
-
-                // Get each reference in turn
-                bool deleted = false;
-                while(mCell->getNextRef(esm[index], ref, deleted))
-                {
-                    // Don't load reference if it was moved to a different cell.
-                    ESM::MovedCellRefTracker::const_iterator iter =
-                        std::find(mCell->mMovedRefs.begin(), mCell->mMovedRefs.end(), ref.mRefNum);
-                    if (iter != mCell->mMovedRefs.end()) {
-                        continue;
-                    }
+            // Don't load reference if it was moved to a different cell.
+            if (cachedRef.mMoved)
+                continue;
 
-                    loadRef (ref, deleted, refNumToID);
-                }
-            }
-            catch (std::exception& e)
-            {
-                Log(Debug::Error) << "An error occurred loading references for cell " << getCell()->getDescription() << ": " << e.what();
-            }
+            ESM::CellRef ref = cachedRef.mRef;
+            loadRef (ref, cachedRef.mDeleted, refNumToID);
         }
 
         // Load moved references, from separately tracked list.
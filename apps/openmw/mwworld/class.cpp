@@ -23,9 +23,9 @@
 
 namespace MWWorld
 {
-    std::map<std::string, std::shared_ptr<Class> > Class::sClasses;
+    std::array<std::shared_ptr<Class>, static_cast<std::size_t>(RefType::Count)> Class::sClasses;
 
-    Class::Class() {}
+    Class::Class() : mType(RefType::Count) {}
 
     Class::~Class() {}
 
@@ -229,17 +229,14 @@ namespace MWWorld
         throw std::runtime_error("Class does not support armor rating");
     }
 
-    const Class& Class::get (const std::string& key)
+    const Class& Class::get (RefType type)
     {
-        if (key.empty())
-            throw std::logic_error ("Class::get(): attempting to get an empty key");
+        const std::size_t index = static_cast<std::size_t>(type);
 
-        std::map<std::string, std::shared_ptr<Class> >::const_iterator iter = sClasses.find (key);
+        if (index>=sClasses.size() || !sClasses[index])
+            throw std::logic_error ("Class::get(): unknown class type: " + std::to_string(index));
 
-        if (iter==sClasses.end())
-            throw std::logic_error ("Class::get(): unknown class key: " + key);
-
-        return *iter->second;
+        return *sClasses[index];
     }
 
     bool Class::isPersistent(const ConstPtr &ptr) const
@@ -247,10 +244,11 @@ namespace MWWorld
         throw std::runtime_error ("class does not support persistence");
     }
 
-    void Class::registerClass(const std::string& key,  std::shared_ptr<Class> instance)
+    void Class::registerClass(RefType type, const std::string& typeName, std::shared_ptr<Class> instance)
     {
-        instance->mTypeName = key;
-        sClasses.insert(std::make_pair(key, instance));
+        instance->mTypeName = typeName;
+        instance->mType = type;
+        sClasses[static_cast<std::size_t>(type)] = instance;
     }
 
     std::string Class::getUpSoundId (const ConstPtr& ptr) const
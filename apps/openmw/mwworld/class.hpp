@@ -1,9 +1,11 @@
 #ifndef GAME_MWWORLD_CLASS_H
 #define GAME_MWWORLD_CLASS_H
 
+#include <array>
 #include <map>
 #include <memory>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 #include <osg/Vec4f>
@@ -53,9 +55,10 @@ namespace MWWorld
     /// \brief Base class for referenceable esm records
     class Class
     {
-            static std::map<std::string, std::shared_ptr<Class> > sClasses;
+            static std::array<std::shared_ptr<Class>, static_cast<std::size_t>(RefType::Count)> sClasses;
 
             std::string mTypeName;
+            RefType mType;
 
             // not implemented
             Class (const Class&);
@@ -78,6 +81,10 @@ namespace MWWorld
                 return mTypeName;
             }
 
+            RefType getType() const {
+                return mType;
+            }
+
             virtual void insertObjectRendering (const Ptr& ptr, const std::string& mesh, MWRender::RenderingInterface& renderingInterface) const;
             virtual void insertObject(const Ptr& ptr, const std::string& mesh, MWPhysics::PhysicsSystem& physics) const;
             ///< Add reference into a cell for rendering (default implementation: don't render anything).
@@ -338,10 +345,16 @@ namespace MWWorld
                 const;
             ///< Write additional state from \a ptr into \a state.
 
-            static const Class& get (const std::string& key);
-            ///< If there is no class for this \a key, an exception is thrown.
+            static const Class& get (RefType type);
+            ///< If there is no class for this \a type, an exception is thrown.
+
+            template <class X>
+            static void registerClass (std::shared_ptr<Class> instance)
+            {
+                registerClass (refTypeOf<X>, typeid (X).name(), instance);
+            }
 
-            static void registerClass (const std::string& key,  std::shared_ptr<Class> instance);
+            static void registerClass (RefType type, const std::string& typeName, std::shared_ptr<Class> instance);
 
             virtual int getBaseGold(const MWWorld::ConstPtr& ptr) const;
 
@@ -20,6 +20,7 @@
 #include "class.hpp"
 #include "localscripts.hpp"
 #include "player.hpp"
+#include "findreplacement.hpp"
 
 namespace
 {
@@ -38,42 +39,29 @@ namespace
         }
     }
 
-    template<typename T>
-    float getTotalWeight (const MWWorld::CellRefList<T>& cellRefList)
+    template<typename T, typename Counts>
+    void addTotals (const MWWorld::CellRefList<T>& cellRefList, double& weight, Counts& counts)
     {
-        float sum = 0;
-
         for (typename MWWorld::CellRefList<T>::List::const_iterator iter (
             cellRefList.mList.begin());
             iter!=cellRefList.mList.end();
             ++iter)
         {
-            if (iter->mData.getCount()>0)
-                sum += iter->mData.getCount()*iter->mBase->mData.mWeight;
-        }
-
-        return sum;
-    }
-
-    template<typename T>
-    MWWorld::Ptr searchId (MWWorld::CellRefList<T>& list, const std::string& id,
-        MWWorld::ContainerStore *store)
-    {
-        store->resolve();
-        std::string id2 = Misc::StringUtils::lowerCase (id);
-
-        for (typename MWWorld::CellRefList<T>::List::iterator iter (list.mList.begin());
-             iter!=list.mList.end(); ++iter)
-        {
-            if (Misc::StringUtils::ciEqual(iter->mBase->mId, id2) && iter->mData.getCount())
+            const int count = iter->mData.getCount();
+            if (count>0)
             {
-                MWWorld::Ptr ptr (&*iter, 0);
-                ptr.setContainerStore (store);
-                return ptr;
+                weight += count*iter->mBase->mData.mWeight;
+                counts[iter->mRef.getRefId()] += count;
             }
         }
+    }
 
-        return MWWorld::Ptr();
+    template<typename T, typename Stacks>
+    void addStacks (MWWorld::CellRefList<T>& cellRefList, Stacks& stacks)
+    {
+        for (typename MWWorld::CellRefList<T>::List::iterator iter (cellRefList.mList.begin());
+             iter!=cellRefList.mList.end(); ++iter)
+            stacks[iter->mRef.getRefId()].push_back(&*iter);
     }
 }
 
@@ -105,6 +93,7 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::getState (CellRefList<T
     LiveCellRef<T> ref (record);
     ref.load (state);
     collection.mList.push_back (ref);
+    mStackIndex.mUpToDate = false;
 
     return ContainerStoreIterator (this, --collection.mList.end());
 }
@@ -147,7 +136,7 @@ MWWorld::ContainerStore::ContainerStore()
     : mListener(nullptr)
     , mRechargingItemsUpToDate(false)
     , mCachedWeight (0)
-    , mWeightUpToDate (false)
+    , mTotalsUpToDate (false)
     , mModified(false)
     , mResolved(false)
     , mSeed()
@@ -187,11 +176,9 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::end()
 
 int MWWorld::ContainerStore::count(const std::string &id) const
 {
-    int total=0;
-    for (const auto& iter : *this)
-        if (Misc::StringUtils::ciEqual(iter.getCellRef().getRefId(), id))
-            total += iter.getRefData().getCount();
-    return total;
+    updateTotals();
+    const auto found = mCachedCounts.find(id);
+    return found != mCachedCounts.end() ? found->second : 0;
 }
 
 MWWorld::ContainerStoreListener* MWWorld::ContainerStore::getContListener() const
@@ -371,8 +358,9 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp (const Ptr& ptr,
         {
             if (Misc::StringUtils::ciEqual((*iter).getCellRef().getRefId(), MWWorld::ContainerStore::sGoldId))
             {
+                const int oldCount = iter->getRefData().getCount();
                 iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), realCount));
-                flagAsModified();
+                flagStackModified(*iter, oldCount);
                 return iter;
             }
         }
@@ -387,9 +375,10 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addImp (const Ptr& ptr,
         if (stacks(*iter, ptr))
         {
             // stack
+            const int oldCount = iter->getRefData().getCount();
             iter->getRefData().setCount(addItems(iter->getRefData().getCount(false), count));
 
-            flagAsModified();
+            flagStackModified(*iter, oldCount);
             return iter;
         }
     }
@@ -419,7 +408,11 @@ MWWorld::ContainerStoreIterator MWWorld::ContainerStore::addNewStack (const Cons
 
     it->getRefData().setCount(count);
 
-    flagAsModified();
+    if (mStackIndex.mUpToDate)
+        mStackIndex.mStacks[it->getCellRef().getRefId()].push_back(it->getBase());
+
+    // The new stack was not part of the totals yet
+    flagStackModified(*it, 0);
     return it;
 }
 
@@ -469,11 +462,18 @@ int MWWorld::ContainerStore::remove(const std::string& itemId, int count, const
         resolve();
     int toRemove = count;
 
-    for (ContainerStoreIterator iter(begin()); iter != end() && toRemove > 0; ++iter)
-        if (Misc::StringUtils::ciEqual(iter->getCellRef().getRefId(), itemId))
-            toRemove -= remove(*iter, toRemove, actor, equipReplacement, resolveFirst);
+    // Copied, since removing equipped items may add stacks
+    const std::vector<LiveCellRefBase*> stacks = getStacks(itemId);
+    for (auto iter = stacks.begin(); iter != stacks.end() && toRemove > 0; ++iter)
+    {
+        // emptied stacks are kept in the store, skip them like search() does
+        if ((*iter)->mData.getCount() == 0)
+            continue;
 
-    flagAsModified();
+        Ptr item(*iter, nullptr);
+        item.setContainerStore(this);
+        toRemove -= remove(item, toRemove, actor, equipReplacement, resolveFirst);
+    }
 
     // number of removed items
     return count - toRemove;
@@ -498,6 +498,7 @@ int MWWorld::ContainerStore::remove(const Ptr& item, int count, const Ptr& actor
 
     int toRemove = count;
     RefData& itemRef = item.getRefData();
+    const int oldCount = itemRef.getCount();
 
     if (itemRef.getCount() <= toRemove)
     {
@@ -510,7 +511,7 @@ int MWWorld::ContainerStore::remove(const Ptr& item, int count, const Ptr& actor
         toRemove = 0;
     }
 
-    flagAsModified();
+    flagStackModified(item, oldCount);
 
     // we should not fire event for InventoryStore yet - it has some custom logic
     if (mListener && !actor.getClass().hasInventoryStore(actor))
@@ -572,7 +573,7 @@ void MWWorld::ContainerStore::addInitialItem (const std::string& id, const std::
 void MWWorld::ContainerStore::addInitialItemImp(const MWWorld::Ptr& ptr, const std::string& owner, int count,
                                                Misc::Rng::Seed* seed, bool topLevel)
 {
-    if (ptr.getTypeName()==typeid (ESM::ItemLevList).name())
+    if (ptr.getType()==MWWorld::RefType::ItemLevList)
     {
         if(!seed)
             return;
@@ -610,10 +611,30 @@ void MWWorld::ContainerStore::clear()
 
 void MWWorld::ContainerStore::flagAsModified()
 {
-    mWeightUpToDate = false;
+    mTotalsUpToDate = false;
     mRechargingItemsUpToDate = false;
 }
 
+void MWWorld::ContainerStore::flagStackModified(const ConstPtr& stack, int oldCount)
+{
+    mRechargingItemsUpToDate = false;
+
+    if (!mTotalsUpToDate)
+        return;
+
+    const int newCount = stack.getRefData().getCount();
+    if (oldCount > 0)
+    {
+        mCachedWeight -= oldCount * stack.getClass().getWeight(stack);
+        mCachedCounts[stack.getCellRef().getRefId()] -= oldCount;
+    }
+    if (newCount > 0)
+    {
+        mCachedWeight += newCount * stack.getClass().getWeight(stack);
+        mCachedCounts[stack.getCellRef().getRefId()] += newCount;
+    }
+}
+
 bool MWWorld::ContainerStore::isResolved() const
 {
     return mResolved;
@@ -653,29 +674,63 @@ MWWorld::ResolutionHandle MWWorld::ContainerStore::resolveTemporarily()
     return {listener};
 }
 
-float MWWorld::ContainerStore::getWeight() const
+void MWWorld::ContainerStore::updateTotals() const
+{
+    if (mTotalsUpToDate)
+        return;
+
+    mCachedWeight = 0;
+    mCachedCounts.clear();
+
+    addTotals (potions, mCachedWeight, mCachedCounts);
+    addTotals (appas, mCachedWeight, mCachedCounts);
+    addTotals (armors, mCachedWeight, mCachedCounts);
+    addTotals (books, mCachedWeight, mCachedCounts);
+    addTotals (clothes, mCachedWeight, mCachedCounts);
+    addTotals (ingreds, mCachedWeight, mCachedCounts);
+    addTotals (lights, mCachedWeight, mCachedCounts);
+    addTotals (lockpicks, mCachedWeight, mCachedCounts);
+    addTotals (miscItems, mCachedWeight, mCachedCounts);
+    addTotals (probes, mCachedWeight, mCachedCounts);
+    addTotals (repairs, mCachedWeight, mCachedCounts);
+    addTotals (weapons, mCachedWeight, mCachedCounts);
+
+    mTotalsUpToDate = true;
+}
+
+const std::vector<MWWorld::LiveCellRefBase*>& MWWorld::ContainerStore::getStacks(const std::string& id) const
 {
-    if (!mWeightUpToDate)
+    if (!mStackIndex.mUpToDate)
     {
-        mCachedWeight = 0;
-
-        mCachedWeight += getTotalWeight (potions);
-        mCachedWeight += getTotalWeight (appas);
-        mCachedWeight += getTotalWeight (armors);
-        mCachedWeight += getTotalWeight (books);
-        mCachedWeight += getTotalWeight (clothes);
-        mCachedWeight += getTotalWeight (ingreds);
-        mCachedWeight += getTotalWeight (lights);
-        mCachedWeight += getTotalWeight (lockpicks);
-        mCachedWeight += getTotalWeight (miscItems);
-        mCachedWeight += getTotalWeight (probes);
-        mCachedWeight += getTotalWeight (repairs);
-        mCachedWeight += getTotalWeight (weapons);
-
-        mWeightUpToDate = true;
+        mStackIndex.mStacks.clear();
+
+        // The index hands out non-const stacks, but only non-const members of the store make use of that
+        ContainerStore& store = const_cast<ContainerStore&>(*this);
+        addStacks (store.potions, mStackIndex.mStacks);
+        addStacks (store.appas, mStackIndex.mStacks);
+        addStacks (store.armors, mStackIndex.mStacks);
+        addStacks (store.books, mStackIndex.mStacks);
+        addStacks (store.clothes, mStackIndex.mStacks);
+        addStacks (store.ingreds, mStackIndex.mStacks);
+        addStacks (store.lights, mStackIndex.mStacks);
+        addStacks (store.lockpicks, mStackIndex.mStacks);
+        addStacks (store.miscItems, mStackIndex.mStacks);
+        addStacks (store.probes, mStackIndex.mStacks);
+        addStacks (store.repairs, mStackIndex.mStacks);
+        addStacks (store.weapons, mStackIndex.mStacks);
+
+        mStackIndex.mUpToDate = true;
     }
 
-    return mCachedWeight;
+    static const std::vector<LiveCellRefBase*> noStacks;
+    const auto found = mStackIndex.mStacks.find(id);
+    return found != mStackIndex.mStacks.end() ? found->second : noStacks;
+}
+
+float MWWorld::ContainerStore::getWeight() const
+{
+    updateTotals();
+    return static_cast<float>(mCachedWeight);
 }
 
 int MWWorld::ContainerStore::getType (const ConstPtr& ptr)
@@ -683,40 +738,40 @@ int MWWorld::ContainerStore::getType (const ConstPtr& ptr)
     if (ptr.isEmpty())
         throw std::runtime_error ("can't put a non-existent object into a container");
 
-    if (ptr.getTypeName()==typeid (ESM::Potion).name())
+    if (ptr.getType()==MWWorld::RefType::Potion)
         return Type_Potion;
 
-    if (ptr.getTypeName()==typeid (ESM::Apparatus).name())
+    if (ptr.getType()==MWWorld::RefType::Apparatus)
         return Type_Apparatus;
 
-    if (ptr.getTypeName()==typeid (ESM::Armor).name())
+    if (ptr.getType()==MWWorld::RefType::Armor)
         return Type_Armor;
 
-    if (ptr.getTypeName()==typeid (ESM::Book).name())
+    if (ptr.getType()==MWWorld::RefType::Book)
         return Type_Book;
 
-    if (ptr.getTypeName()==typeid (ESM::Clothing).name())
+    if (ptr.getType()==MWWorld::RefType::Clothing)
         return Type_Clothing;
 
-    if (ptr.getTypeName()==typeid (ESM::Ingredient).name())
+    if (ptr.getType()==MWWorld::RefType::Ingredient)
         return Type_Ingredient;
 
-    if (ptr.getTypeName()==typeid (ESM::Light).name())
+    if (ptr.getType()==MWWorld::RefType::Light)
         return Type_Light;
 
-    if (ptr.getTypeName()==typeid (ESM::Lockpick).name())
+    if (ptr.getType()==MWWorld::RefType::Lockpick)
         return Type_Lockpick;
 
-    if (ptr.getTypeName()==typeid (ESM::Miscellaneous).name())
+    if (ptr.getType()==MWWorld::RefType::Miscellaneous)
         return Type_Miscellaneous;
 
-    if (ptr.getTypeName()==typeid (ESM::Probe).name())
+    if (ptr.getType()==MWWorld::RefType::Probe)
         return Type_Probe;
 
-    if (ptr.getTypeName()==typeid (ESM::Repair).name())
+    if (ptr.getType()==MWWorld::RefType::Repair)
         return Type_Repair;
 
-    if (ptr.getTypeName()==typeid (ESM::Weapon).name())
+    if (ptr.getType()==MWWorld::RefType::Weapon)
         return Type_Weapon;
 
     throw std::runtime_error (
@@ -725,101 +780,36 @@ int MWWorld::ContainerStore::getType (const ConstPtr& ptr)
 
 MWWorld::Ptr MWWorld::ContainerStore::findReplacement(const std::string& id)
 {
-    MWWorld::Ptr item;
-    int itemHealth = 1;
-    for (MWWorld::ContainerStoreIterator iter = begin(); iter != end(); ++iter)
-    {
-        int iterHealth = iter->getClass().hasItemHealth(*iter) ? iter->getClass().getItemHealth(*iter) : 1;
-        if (Misc::StringUtils::ciEqual(iter->getCellRef().getRefId(), id))
+    const std::vector<LiveCellRefBase*>& stacks = getStacks(id);
+    const auto found = MWWorld::findReplacement(stacks.begin(), stacks.end(),
+        [] (const LiveCellRefBase* stack) { return stack->mData.getCount(); },
+        [this] (LiveCellRefBase* stack)
         {
-            // Prefer the stack with the lowest remaining uses
-            // Try to get item with zero durability only if there are no other items found
-            if (item.isEmpty() ||
-                (iterHealth > 0 && iterHealth < itemHealth) ||
-                (itemHealth <= 0 && iterHealth > 0))
-            {
-                item = *iter;
-                itemHealth = iterHealth;
-            }
-        }
-    }
+            Ptr ptr(stack, nullptr);
+            ptr.setContainerStore(this);
+            return ptr.getClass().hasItemHealth(ptr) ? ptr.getClass().getItemHealth(ptr) : 1;
+        });
 
+    if (found == stacks.end())
+        return Ptr();
+
+    Ptr item(*found, nullptr);
+    item.setContainerStore(this);
     return item;
 }
 
 MWWorld::Ptr MWWorld::ContainerStore::search (const std::string& id)
 {
     resolve();
-    {
-        Ptr ptr = searchId (potions, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (appas, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (armors, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (books, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (clothes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (ingreds, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
 
+    for (LiveCellRefBase* stack : getStacks(id))
     {
-        Ptr ptr = searchId (lights, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (lockpicks, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (miscItems, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (probes, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (repairs, id, this);
-        if (!ptr.isEmpty())
-            return ptr;
-    }
-
-    {
-        Ptr ptr = searchId (weapons, id, this);
-        if (!ptr.isEmpty())
+        if (stack->mData.getCount())
+        {
+            Ptr ptr(stack, nullptr);
+            ptr.setContainerStore(this);
             return ptr;
+        }
     }
 
     return Ptr();
@@ -4,7 +4,9 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <components/esm/loadalch.hpp>
 #include <components/esm/loadappa.hpp>
@@ -20,6 +22,7 @@
 #include <components/esm/loadweap.hpp>
 
 #include <components/misc/rng.hpp>
+#include <components/misc/stringops.hpp>
 
 #include "ptr.hpp"
 #include "cellreflist.hpp"
@@ -116,8 +119,29 @@ namespace MWWorld
             MWWorld::CellRefList<ESM::Repair>            repairs;
             MWWorld::CellRefList<ESM::Weapon>            weapons;
 
-            mutable float mCachedWeight;
-            mutable bool mWeightUpToDate;
+            // Totals over all stacks. Rebuilt lazily after flagAsModified(), and adjusted in place by
+            // flagStackModified() while they are up to date, so adding and removing items does not need a rescan.
+            mutable double mCachedWeight;
+            mutable std::map<std::string, int, Misc::StringUtils::CiComp> mCachedCounts;
+            mutable bool mTotalsUpToDate;
+
+            typedef std::unordered_map<std::string, std::vector<LiveCellRefBase*>,
+                Misc::StringUtils::CiHash, Misc::StringUtils::CiEqual> StackMap;
+
+            /// Stacks of each item ID, in the order of the lists. Stacks are never erased from the lists (emptied
+            /// stacks keep a count of 0), so it only has to be extended when a stack is added.
+            /// It refers to the lists of its own store, so copies of a store start without one and build their own.
+            struct StackIndex
+            {
+                StackMap mStacks;
+                bool mUpToDate = false;
+
+                StackIndex() = default;
+                StackIndex(const StackIndex&) {}
+                StackIndex& operator= (const StackIndex&) { mStacks.clear(); mUpToDate = false; return *this; }
+            };
+
+            mutable StackIndex mStackIndex;
 
             bool mModified;
             bool mResolved;
@@ -143,6 +167,11 @@ namespace MWWorld
 
             void updateRechargingItems();
 
+            void updateTotals() const;
+
+            const std::vector<LiveCellRefBase*>& getStacks (const std::string& id) const;
+            ///< All stacks of item ID \a id, including empty ones
+
             virtual void storeEquipmentState (const MWWorld::LiveCellRefBase& ref, int index, ESM::InventoryState& inventory) const;
 
             virtual void readEquipmentState (const MWWorld::ContainerStoreIterator& iter, int index, const ESM::InventoryState& inventory);
@@ -212,6 +241,10 @@ namespace MWWorld
 
             virtual void flagAsModified();
 
+            void flagStackModified (const ConstPtr& stack, int oldCount);
+            ///< Like flagAsModified(), for when only the count of \a stack changed (from \a oldCount, as returned by
+            /// RefData::getCount()). Keeps the cached totals up to date instead of discarding them.
+
             /// + and - operations that can deal with negative stacks
             /// Note that negativity is infectious
             static int addItems(int count1, int count2);
@@ -1,5 +1,6 @@
 #include "esmstore.hpp"
 
+#include <algorithm>
 #include <set>
 
 #include <boost/filesystem/operations.hpp>
@@ -11,45 +12,6 @@
 
 #include "../mwmechanics/spelllist.hpp"
 
-namespace
-{
-    void readRefs(const ESM::Cell& cell, std::map<ESM::RefNum, std::string>& refs, std::vector<ESM::ESMReader>& readers)
-    {
-        for (size_t i = 0; i < cell.mContextList.size(); i++)
-        {
-            size_t index = cell.mContextList[i].index;
-            if (readers.size() <= index)
-                readers.resize(index + 1);
-            cell.restore(readers[index], i);
-            ESM::CellRef ref;
-            ref.mRefNum.mContentFile = ESM::RefNum::RefNum_NoContentFile;
-            bool deleted = false;
-            while(cell.getNextRef(readers[index], ref, deleted))
-            {
-                if(deleted)
-                    refs.erase(ref.mRefNum);
-                else if (std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRefNum) == cell.mMovedRefs.end())
-                {
-                    Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                    refs[ref.mRefNum] = ref.mRefID;
-                }
-            }
-        }
-        for(const auto& it : cell.mLeasedRefs)
-        {
-            bool deleted = it.second;
-            if(deleted)
-                refs.erase(it.first.mRefNum);
-            else
-            {
-                ESM::CellRef ref = it.first;
-                Misc::StringUtils::lowerCaseInPlace(ref.mRefID);
-                refs[ref.mRefNum] = ref.mRefID;
-            }
-        }
-    }
-}
-
 namespace MWWorld
 {
 
@@ -199,14 +161,92 @@ void ESMStore::countRecords()
         return;
     std::map<ESM::RefNum, std::string> refs;
     std::vector<ESM::ESMReader> readers;
+    const auto readRefs = [&] (const ESM::Cell& cell)
+    {
+        for (const CachedCellRef& ref : *getCellRefs(cell, readers))
+        {
+            if (ref.mDeleted)
+                refs.erase(ref.mRef.mRefNum);
+            else if (!ref.mMoved)
+                refs[ref.mRef.mRefNum] = ref.mLowerCaseRefId;
+        }
+        for(const auto& it : cell.mLeasedRefs)
+        {
+            bool deleted = it.second;
+            if(deleted)
+                refs.erase(it.first.mRefNum);
+            else
+                refs[it.first.mRefNum] = Misc::StringUtils::lowerCase(it.first.mRefID);
+        }
+    };
     for(auto it = mCells.intBegin(); it != mCells.intEnd(); it++)
-        readRefs(*it, refs, readers);
+        readRefs(*it);
     for(auto it = mCells.extBegin(); it != mCells.extEnd(); it++)
-        readRefs(*it, refs, readers);
+        readRefs(*it);
     for(const auto& pair : refs)
         mRefCount[pair.second]++;
 }
 
+void ESMStore::setCellRefCacheSize(std::size_t size)
+{
+    mCellRefCacheSize = size;
+    while (mCellRefCache.size() > mCellRefCacheSize)
+    {
+        mCellRefCacheIndex.erase(mCellRefCache.back().first);
+        mCellRefCache.pop_back();
+    }
+}
+
+std::shared_ptr<const CachedCellRefs> ESMStore::getCellRefs(const ESM::Cell& cell, std::vector<ESM::ESMReader>& readers) const
+{
+    auto found = mCellRefCacheIndex.find(&cell);
+    if (found != mCellRefCacheIndex.end())
+    {
+        mCellRefCache.splice(mCellRefCache.begin(), mCellRefCache, found->second);
+        return found->second->second;
+    }
+
+    auto refs = std::make_shared<CachedCellRefs>();
+
+    for (size_t i = 0; i < cell.mContextList.size(); i++)
+    {
+        try
+        {
+            size_t index = cell.mContextList[i].index;
+            if (readers.size() <= index)
+                readers.resize(index + 1);
+            cell.restore(readers[index], i);
+
+            CachedCellRef ref;
+            ref.mRef.mRefNum.mContentFile = ESM::RefNum::RefNum_NoContentFile;
+            while (cell.getNextRef(readers[index], ref.mRef, ref.mDeleted))
+            {
+                ref.mLowerCaseRefId = Misc::StringUtils::lowerCase(ref.mRef.mRefID);
+                ref.mMoved = std::find(cell.mMovedRefs.begin(), cell.mMovedRefs.end(), ref.mRef.mRefNum) != cell.mMovedRefs.end();
+                refs->push_back(ref);
+            }
+        }
+        catch (std::exception& e)
+        {
+            Log(Debug::Error) << "An error occurred reading references for cell " << cell.getDescription() << ": " << e.what();
+        }
+    }
+
+    // dynamically generated cells have no references in the content files
+    if (mCellRefCacheSize > 0 && !cell.mContextList.empty())
+    {
+        if (mCellRefCache.size() >= mCellRefCacheSize)
+        {
+            mCellRefCacheIndex.erase(mCellRefCache.back().first);
+            mCellRefCache.pop_back();
+        }
+        mCellRefCache.emplace_front(&cell, refs);
+        mCellRefCacheIndex[&cell] = mCellRefCache.begin();
+    }
+
+    return refs;
+}
+
 int ESMStore::getRefCount(const std::string& id) const
 {
     const std::string lowerId = Misc::StringUtils::lowerCase(id);
@@ -1,10 +1,12 @@
 #ifndef OPENMW_MWWORLD_ESMSTORE_H
 #define OPENMW_MWWORLD_ESMSTORE_H
 
+#include <list>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
 
+#include <components/esm/cellref.hpp>
 #include <components/esm/records.hpp>
 #include "store.hpp"
 
@@ -20,6 +22,17 @@ namespace MWMechanics
 
 namespace MWWorld
 {
+    /// A cell reference as read from a content file.
+    struct CachedCellRef
+    {
+        ESM::CellRef mRef; ///< Unchanged, including the case of its ID.
+        std::string mLowerCaseRefId; ///< For lookups only.
+        bool mDeleted;
+        bool mMoved; ///< Listed in the cell's moved references, i.e. now belongs to another cell.
+    };
+
+    typedef std::vector<CachedCellRef> CachedCellRefs;
+
     class ESMStore
     {
         Store<ESM::Activator>       mActivators;
@@ -86,6 +99,13 @@ namespace MWWorld
 
         mutable std::map<std::string, std::weak_ptr<MWMechanics::SpellList> > mSpellListCache;
 
+        typedef std::pair<const ESM::Cell*, std::shared_ptr<const CachedCellRefs> > CellRefCacheEntry;
+
+        // most recently used first
+        mutable std::list<CellRefCacheEntry> mCellRefCache;
+        mutable std::map<const ESM::Cell*, std::list<CellRefCacheEntry>::iterator> mCellRefCacheIndex;
+        std::size_t mCellRefCacheSize;
+
         /// Validate entries in store after setup
         void validate();
 
@@ -122,7 +142,7 @@ namespace MWWorld
         }
 
         ESMStore()
-          : mDynamicCount(0)
+          : mDynamicCount(0), mCellRefCacheSize(0)
         {
             mStores[ESM::REC_ACTI] = &mActivators;
             mStores[ESM::REC_ALCH] = &mPotions;
@@ -267,6 +287,13 @@ namespace MWWorld
         /// @return The number of instances defined in the base files. Excludes changes from the save file.
         int getRefCount(const std::string& id) const;
 
+        /// Set the number of cells for which getCellRefs keeps the parsed references around.
+        void setCellRefCacheSize(std::size_t size);
+
+        /// @return The references of \a cell in all content files, in load order.
+        /// \note The content files are only read if the references are not cached already.
+        std::shared_ptr<const CachedCellRefs> getCellRefs(const ESM::Cell& cell, std::vector<ESM::ESMReader>& readers) const;
+
         /// Actors with the same ID share spells, abilities, etc.
         /// @return The shared spell list to use for this actor and whether or not it has already been initialized.
         std::pair<std::shared_ptr<MWMechanics::SpellList>, bool> getSpellList(const std::string& id) const;
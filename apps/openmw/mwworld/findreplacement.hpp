@@ -0,0 +1,34 @@
+#ifndef GAME_MWWORLD_FINDREPLACEMENT_H
+#define GAME_MWWORLD_FINDREPLACEMENT_H
+
+namespace MWWorld
+{
+    /// \brief Pick the stack to use in place of an item that was used up or removed.
+    ///
+    /// Emptied stacks are skipped. The stack with the lowest remaining uses is preferred, a stack with no uses
+    /// left is only picked if no other stack is found.
+    /// @param getCount Number of items in a stack
+    /// @param getHealth Remaining uses of a stack, 1 for items without health
+    /// @return \a end if every stack is empty
+    template <class Iterator, class GetCount, class GetHealth>
+    Iterator findReplacement(Iterator begin, Iterator end, GetCount&& getCount, GetHealth&& getHealth)
+    {
+        Iterator found = end;
+        int foundHealth = 1;
+        for (Iterator it = begin; it != end; ++it)
+        {
+            if (getCount(*it) == 0)
+                continue;
+
+            const int health = getHealth(*it);
+            if (found == end || (health > 0 && health < foundHealth) || (foundHealth <= 0 && health > 0))
+            {
+                found = it;
+                foundHealth = health;
+            }
+        }
+        return found;
+    }
+}
+
+#endif
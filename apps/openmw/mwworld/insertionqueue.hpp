@@ -0,0 +1,84 @@
+#ifndef GAME_MWWORLD_INSERTIONQUEUE_H
+#define GAME_MWWORLD_INSERTIONQUEUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+namespace MWWorld
+{
+    /// \brief Objects of loaded cells waiting to be inserted into the scene, a few at a time.
+    ///
+    /// Cells farther from the player come first, so that the far side of the grid is streamed in
+    /// while the player is still far from it. Cells at the same distance keep the order they were
+    /// pushed in. A cell that is partially inserted is always finished first.
+    template <class Cell, class Object>
+    class InsertionQueue
+    {
+        public:
+
+            void push (const Cell& cell, int distance, std::vector<Object> objects)
+            {
+                auto position = mCells.begin();
+                if (position != mCells.end() && position->mInserted > 0)
+                    ++position;
+                position = std::find_if(position, mCells.end(),
+                    [&] (const Entry& entry) { return entry.mDistance < distance; });
+                mCells.insert(position, Entry {cell, distance, std::move(objects), 0});
+            }
+
+            void erase (const Cell& cell)
+            {
+                mCells.erase(std::remove_if(mCells.begin(), mCells.end(),
+                    [&] (const Entry& entry) { return entry.mCell == cell; }), mCells.end());
+            }
+
+            bool empty() const
+            {
+                return mCells.empty();
+            }
+
+            /// Pass queued objects to \a insert until the queue is empty or \a isOverBudget returns true.
+            /// The budget is checked after each object, so every call makes progress.
+            /// @return Number of objects passed to \a insert.
+            template <class Insert, class IsOverBudget>
+            std::size_t process (Insert&& insert, IsOverBudget&& isOverBudget)
+            {
+                std::size_t processed = 0;
+
+                while (!mCells.empty())
+                {
+                    Entry& entry = mCells.front();
+
+                    if (entry.mInserted < entry.mObjects.size())
+                    {
+                        insert(entry.mObjects[entry.mInserted++]);
+                        ++processed;
+                    }
+
+                    if (entry.mInserted == entry.mObjects.size())
+                        mCells.pop_front();
+
+                    if (isOverBudget())
+                        break;
+                }
+
+                return processed;
+            }
+
+        private:
+
+            struct Entry
+            {
+                Cell mCell;
+                int mDistance;
+                std::vector<Object> mObjects;
+                std::size_t mInserted;
+            };
+
+            std::deque<Entry> mCells;
+    };
+}
+
+#endif
@@ -89,6 +89,7 @@ void MWWorld::InventoryStore::readEquipmentState(const MWWorld::ContainerStoreIt
             int count = iter->getRefData().getCount(false);
             MWWorld::ContainerStoreIterator newIter = addNewStack(*iter, count > 0 ? 1 : -1);
             iter->getRefData().setCount(subtractItems(count, 1));
+            flagStackModified(*iter, std::abs(count));
             mSlots[slot] = newIter;
         }
         else
@@ -98,6 +99,7 @@ void MWWorld::InventoryStore::readEquipmentState(const MWWorld::ContainerStoreIt
 
 MWWorld::InventoryStore::InventoryStore()
  : ContainerStore()
+ , mMagicEffectsRevision(0)
  , mInventoryListener(nullptr)
  , mUpdatesEnabled (true)
  , mFirstAutoEquip(true)
@@ -109,6 +111,7 @@ MWWorld::InventoryStore::InventoryStore()
 MWWorld::InventoryStore::InventoryStore (const InventoryStore& store)
  : ContainerStore (store)
  , mMagicEffects(store.mMagicEffects)
+ , mMagicEffectsRevision(store.mMagicEffectsRevision + 1)
  , mInventoryListener(store.mInventoryListener)
  , mUpdatesEnabled(store.mUpdatesEnabled)
  , mFirstAutoEquip(store.mFirstAutoEquip)
@@ -123,6 +126,7 @@ MWWorld::InventoryStore& MWWorld::InventoryStore::operator= (const InventoryStor
     mListener = store.mListener;
     mInventoryListener = store.mInventoryListener;
     mMagicEffects = store.mMagicEffects;
+    ++mMagicEffectsRevision;
     mFirstAutoEquip = store.mFirstAutoEquip;
     mPermanentMagicEffectMagnitudes = store.mPermanentMagicEffectMagnitudes;
     mRechargingItemsUpToDate = false;
@@ -140,8 +144,8 @@ MWWorld::ContainerStoreIterator MWWorld::InventoryStore::add(const Ptr& itemPtr,
     if (allowAutoEquip && actorPtr != MWMechanics::getPlayer()
             && actorPtr.getClass().isNpc() && !actorPtr.getClass().getNpcStats(actorPtr).isWerewolf())
     {
-        std::string type = itemPtr.getTypeName();
-        if (type == typeid(ESM::Armor).name() || type == typeid(ESM::Clothing).name())
+        MWWorld::RefType type = itemPtr.getType();
+        if (type == MWWorld::RefType::Armor || type == MWWorld::RefType::Clothing)
             autoEquip(actorPtr);
     }
 
@@ -435,7 +439,7 @@ void MWWorld::InventoryStore::autoEquipArmor (const MWWorld::Ptr& actor, TSlots&
 
                 if (iter.getType() == ContainerStore::Type_Armor)
                 {
-                    if (old.getTypeName() == typeid(ESM::Armor).name())
+                    if (old.getType() == MWWorld::RefType::Armor)
                     {
                         if (old.get<ESM::Armor>()->mBase->mData.mType < test.get<ESM::Armor>()->mBase->mData.mType)
                             continue;
@@ -469,7 +473,7 @@ void MWWorld::InventoryStore::autoEquipArmor (const MWWorld::Ptr& actor, TSlots&
                         }
                     }
 
-                    if (old.getTypeName() == typeid(ESM::Clothing).name())
+                    if (old.getType() == MWWorld::RefType::Clothing)
                     {
                         // check value
                         if (old.getClass().getValue (old) >= test.getClass().getValue (test))
@@ -561,6 +565,11 @@ const MWMechanics::MagicEffects& MWWorld::InventoryStore::getMagicEffects() cons
     return mMagicEffects;
 }
 
+unsigned int MWWorld::InventoryStore::getMagicEffectsRevision() const
+{
+    return mMagicEffectsRevision;
+}
+
 void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
 {
     // To avoid excessive updates during auto-equip
@@ -572,6 +581,7 @@ void MWWorld::InventoryStore::updateMagicEffects(const Ptr& actor)
         return;
 
     mMagicEffects = MWMechanics::MagicEffects();
+    ++mMagicEffectsRevision;
 
     const auto& stats = actor.getClass().getCreatureStats(actor);
     if (stats.isDead() && stats.isDeathAnimationFinished())
@@ -737,8 +747,8 @@ int MWWorld::InventoryStore::remove(const Ptr& item, int count, const Ptr& actor
     if (equipReplacement && wasEquipped && (actor != MWMechanics::getPlayer())
             && actor.getClass().isNpc() && !actor.getClass().getNpcStats(actor).isWerewolf())
     {
-        std::string type = item.getTypeName();
-        if (type == typeid(ESM::Armor).name() || type == typeid(ESM::Clothing).name())
+        MWWorld::RefType type = item.getType();
+        if (type == MWWorld::RefType::Armor || type == MWWorld::RefType::Clothing)
             autoEquip(actor);
     }
 
@@ -954,7 +964,10 @@ void MWWorld::InventoryStore::purgeEffect(short effectId, const std::string &sou
                 magnitude *= params[i].mMultiplier;
 
                 if (magnitude)
+                {
                     mMagicEffects.add (*effectIt, -magnitude);
+                    ++mMagicEffectsRevision;
+                }
 
                 params[i].mMultiplier = 0;
             }
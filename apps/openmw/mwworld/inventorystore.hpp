@@ -69,6 +69,7 @@ namespace MWWorld
         private:
 
             MWMechanics::MagicEffects mMagicEffects;
+            unsigned int mMagicEffectsRevision;
 
             InventoryStoreListener* mInventoryListener;
 
@@ -162,6 +163,9 @@ namespace MWWorld
             const MWMechanics::MagicEffects& getMagicEffects() const;
             ///< Return magic effects from worn items.
 
+            unsigned int getMagicEffectsRevision() const;
+            ///< Return a number that changes whenever the result of getMagicEffects() changes.
+
             bool stacks (const ConstPtr& ptr1, const ConstPtr& ptr2) const override;
             ///< @return true if the two specified objects can stack with each other
 
@@ -10,8 +10,8 @@
 #include "class.hpp"
 #include "esmstore.hpp"
 
-MWWorld::LiveCellRefBase::LiveCellRefBase(const std::string& type, const ESM::CellRef &cref)
-  : mClass(&Class::get(type)), mRef(cref), mData(cref)
+MWWorld::LiveCellRefBase::LiveCellRefBase(RefType type, const ESM::CellRef &cref)
+  : mClass(&Class::get(type)), mType(type), mRef(cref), mData(cref)
 {
 }
 
@@ -4,6 +4,7 @@
 #include <typeinfo>
 
 #include "cellref.hpp"
+#include "reftype.hpp"
 
 #include "refdata.hpp"
 
@@ -23,6 +24,9 @@ namespace MWWorld
     {
         const Class *mClass;
 
+        /// Record type this reference is based on, duplicated from mClass for cheap access.
+        RefType mType;
+
         /** Information about this instance, such as 3D location and rotation
          * and individual type-dependent data.
          */
@@ -31,7 +35,7 @@ namespace MWWorld
         /** runtime-data */
         RefData mData;
 
-        LiveCellRefBase(const std::string& type, const ESM::CellRef &cref=ESM::CellRef());
+        LiveCellRefBase(RefType type, const ESM::CellRef &cref=ESM::CellRef());
         /* Need this for the class to be recognized as polymorphic */
         virtual ~LiveCellRefBase() { }
 
@@ -76,12 +80,14 @@ namespace MWWorld
     template <typename X>
     struct LiveCellRef : public LiveCellRefBase
     {
+        static_assert(refTypeOf<X> != RefType::Count, "X is not a referenceable record type");
+
         LiveCellRef(const ESM::CellRef& cref, const X* b = nullptr)
-            : LiveCellRefBase(typeid(X).name(), cref), mBase(b)
+            : LiveCellRefBase(refTypeOf<X>, cref), mBase(b)
         {}
 
         LiveCellRef(const X* b = nullptr)
-            : LiveCellRefBase(typeid(X).name()), mBase(b)
+            : LiveCellRefBase(refTypeOf<X>), mBase(b)
         {}
 
         // The object that this instance is based on.
@@ -43,7 +43,7 @@ namespace
         bool operator()(const MWWorld::Ptr& containerPtr)
         {
             // Ignore containers without generated content
-            if (containerPtr.getTypeName() == typeid(ESM::Container).name() &&
+            if (containerPtr.getType() == MWWorld::RefType::Container &&
                 containerPtr.getRefData().getCustomData() == nullptr)
                 return true;
 
@@ -127,6 +127,18 @@ void MWWorld::LocalScripts::addCell (CellStore *cell)
     cell->forEachType<ESM::Container>(addContainerItemScriptsVisitor);
 }
 
+void MWWorld::LocalScripts::addObject (const Ptr& ptr)
+{
+    AddScriptsVisitor addScriptsVisitor(*this);
+    addScriptsVisitor(ptr);
+
+    if (ptr.getType() == RefType::NPC || ptr.getType() == RefType::Creature || ptr.getType() == RefType::Container)
+    {
+        AddContainerItemScriptsVisitor addContainerItemScriptsVisitor(*this);
+        addContainerItemScriptsVisitor(ptr);
+    }
+}
+
 void MWWorld::LocalScripts::clear()
 {
     mScripts.clear();
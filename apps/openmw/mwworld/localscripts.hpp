@@ -36,6 +36,9 @@ namespace MWWorld
             void addCell (CellStore *cell);
             ///< Add all local scripts in a cell.
 
+            void addObject (const Ptr& ptr);
+            ///< Add the local script of a reference and the local scripts of the items it holds.
+
             void clear();
             ///< Clear active local scripts collection.
 
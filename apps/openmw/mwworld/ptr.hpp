@@ -37,6 +37,13 @@ namespace MWWorld
 
             const std::string& getTypeName() const;
 
+            RefType getType() const
+            {
+                if(mRef != 0)
+                    return mRef->mType;
+                throw std::runtime_error("Can't get type of an empty object.");
+            }
+
             const Class& getClass() const
             {
                 if(mRef != 0)
@@ -113,6 +120,13 @@ namespace MWWorld
 
         const std::string& getTypeName() const;
 
+        RefType getType() const
+        {
+            if(mRef != 0)
+                return mRef->mType;
+            throw std::runtime_error("Can't get type of an empty object.");
+        }
+
         const Class& getClass() const
         {
             if(mRef != 0)
@@ -0,0 +1,88 @@
+#ifndef GAME_MWWORLD_REFTYPE_H
+#define GAME_MWWORLD_REFTYPE_H
+
+namespace ESM
+{
+    struct Activator;
+    struct Potion;
+    struct Apparatus;
+    struct Armor;
+    struct Book;
+    struct Clothing;
+    struct Container;
+    struct Creature;
+    struct Door;
+    struct Ingredient;
+    struct CreatureLevList;
+    struct ItemLevList;
+    struct Light;
+    struct Lockpick;
+    struct Miscellaneous;
+    struct NPC;
+    struct Probe;
+    struct Repair;
+    struct Static;
+    struct Weapon;
+    struct BodyPart;
+}
+
+namespace MWWorld
+{
+    /// \brief Compact tag of the record type a reference is based on
+    ///
+    /// Use this to branch on the type of an object instead of comparing type names.
+    enum class RefType : unsigned char
+    {
+        Activator,
+        Potion,
+        Apparatus,
+        Armor,
+        Book,
+        Clothing,
+        Container,
+        Creature,
+        Door,
+        Ingredient,
+        CreatureLevList,
+        ItemLevList,
+        Light,
+        Lockpick,
+        Miscellaneous,
+        NPC,
+        Probe,
+        Repair,
+        Static,
+        Weapon,
+        BodyPart,
+
+        Count
+    };
+
+    /// Tag of the record type \a X, or RefType::Count if \a X can not be referenced in a cell.
+    template <class X>
+    inline constexpr RefType refTypeOf = RefType::Count;
+
+    template <> inline constexpr RefType refTypeOf<ESM::Activator> = RefType::Activator;
+    template <> inline constexpr RefType refTypeOf<ESM::Potion> = RefType::Potion;
+    template <> inline constexpr RefType refTypeOf<ESM::Apparatus> = RefType::Apparatus;
+    template <> inline constexpr RefType refTypeOf<ESM::Armor> = RefType::Armor;
+    template <> inline constexpr RefType refTypeOf<ESM::Book> = RefType::Book;
+    template <> inline constexpr RefType refTypeOf<ESM::Clothing> = RefType::Clothing;
+    template <> inline constexpr RefType refTypeOf<ESM::Container> = RefType::Container;
+    template <> inline constexpr RefType refTypeOf<ESM::Creature> = RefType::Creature;
+    template <> inline constexpr RefType refTypeOf<ESM::Door> = RefType::Door;
+    template <> inline constexpr RefType refTypeOf<ESM::Ingredient> = RefType::Ingredient;
+    template <> inline constexpr RefType refTypeOf<ESM::CreatureLevList> = RefType::CreatureLevList;
+    template <> inline constexpr RefType refTypeOf<ESM::ItemLevList> = RefType::ItemLevList;
+    template <> inline constexpr RefType refTypeOf<ESM::Light> = RefType::Light;
+    template <> inline constexpr RefType refTypeOf<ESM::Lockpick> = RefType::Lockpick;
+    template <> inline constexpr RefType refTypeOf<ESM::Miscellaneous> = RefType::Miscellaneous;
+    template <> inline constexpr RefType refTypeOf<ESM::NPC> = RefType::NPC;
+    template <> inline constexpr RefType refTypeOf<ESM::Probe> = RefType::Probe;
+    template <> inline constexpr RefType refTypeOf<ESM::Repair> = RefType::Repair;
+    template <> inline constexpr RefType refTypeOf<ESM::Static> = RefType::Static;
+    template <> inline constexpr RefType refTypeOf<ESM::Weapon> = RefType::Weapon;
+    template <> inline constexpr RefType refTypeOf<ESM::BodyPart> = RefType::BodyPart;
+}
+
+#endif
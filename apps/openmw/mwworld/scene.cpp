@@ -1,5 +1,6 @@
 #include "scene.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <chrono>
 #include <thread>
@@ -225,23 +226,29 @@ namespace
         return true;
     }
 
+    template <class AddObject>
+    void insertObject(const MWWorld::Ptr& ptr, AddObject&& addObject)
+    {
+        if (ptr.getRefData().isDeleted() || !ptr.getRefData().isEnabled())
+            return;
+
+        try
+        {
+            addObject(ptr);
+        }
+        catch (const std::exception& e)
+        {
+            std::string error ("failed to render '" + ptr.getCellRef().getRefId() + "': ");
+            Log(Debug::Error) << error + e.what();
+        }
+    }
+
     template <class AddObject>
     void InsertVisitor::insert(AddObject&& addObject)
     {
         for (MWWorld::Ptr& ptr : mToInsert)
         {
-            if (!ptr.getRefData().isDeleted() && ptr.getRefData().isEnabled())
-            {
-                try
-                {
-                    addObject(ptr);
-                }
-                catch (const std::exception& e)
-                {
-                    std::string error ("failed to render '" + ptr.getCellRef().getRefId() + "': ");
-                    Log(Debug::Error) << error + e.what();
-                }
-            }
+            insertObject(ptr, addObject);
 
             if (!mTest)
                 mLoadingListener.increaseProgress (1);
@@ -310,6 +317,8 @@ namespace MWWorld
         mPreloader->updateCache(mRendering.getReferenceTime());
         preloadCells(duration);
 
+        insertPendingObjects(true);
+
         mRendering.update (duration, paused);
     }
 
@@ -318,6 +327,8 @@ namespace MWWorld
         if (!test)
             Log(Debug::Info) << "Unloading cell " << (*iter)->getCell()->getDescription();
 
+        mPendingObjects.erase(*iter);
+
         const auto navigator = MWBase::Environment::get().getWorld()->getNavigator();
         ListAndResetObjectsVisitor visitor;
 
@@ -373,7 +384,7 @@ namespace MWWorld
         mActiveCells.erase(*iter);
     }
 
-    void Scene::loadCell (CellStore *cell, Loading::Listener* loadingListener, bool respawn, bool test)
+    void Scene::loadCell (CellStore *cell, Loading::Listener* loadingListener, bool respawn, bool test, bool deferObjects)
     {
         std::pair<CellStoreCollection::iterator, bool> result = mActiveCells.insert(cell);
 
@@ -418,14 +429,19 @@ namespace MWWorld
                 navigator->addPathgrid(*cell->getCell(), *pathgrid);
 
             // register local scripts
-            // do this before insertCell, to make sure we don't add scripts from levelled creature spawning twice
-            MWBase::Environment::get().getWorld()->getLocalScripts().addCell (cell);
+            // do this before insertCell, to make sure we don't add scripts from levelled creature spawning twice.
+            // Queued references get theirs when they are inserted.
+            if (!deferObjects)
+                MWBase::Environment::get().getWorld()->getLocalScripts().addCell (cell);
 
             if (respawn)
                 cell->respawn();
 
             // ... then references. This is important for adjustPosition to work correctly.
-            insertCell (*cell, loadingListener, test);
+            if (deferObjects)
+                queueCell (*cell);
+            else
+                insertCell (*cell, loadingListener, test);
 
             mRendering.addCell(cell);
             if (!test)
@@ -511,10 +527,10 @@ namespace MWWorld
 
         osg::Vec2i newCell = getNewGridCenter(pos, &mCurrentGridCenter);
         if (newCell != mCurrentGridCenter)
-            changeCellGrid(pos, newCell.x(), newCell.y());
+            changeCellGrid(pos, newCell.x(), newCell.y(), true, mInsertionBudget > 0);
     }
 
-    void Scene::changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent)
+    void Scene::changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent, bool incremental)
     {
         CellStoreCollection::iterator active = mActiveCells.begin();
         while (active!=mActiveCells.end())
@@ -532,6 +548,15 @@ namespace MWWorld
             unloadCell (active++);
         }
 
+        // cells that stay in the grid must be complete before anything depends on a synchronous load
+        if (!incremental)
+            insertPendingObjects(false);
+
+        const auto isDeferred = [&] (int x, int y)
+        {
+            return incremental && (x != playerCellX || y != playerCellY);
+        };
+
         mCurrentGridCenter = osg::Vec2i(playerCellX, playerCellY);
         osg::Vec4i newGrid = gridCenterToBounds(mCurrentGridCenter);
         mRendering.setActiveGrid(newGrid);
@@ -562,7 +587,8 @@ namespace MWWorld
 
                 if (iter==mActiveCells.end())
                 {
-                    refsToLoad += MWBase::Environment::get().getWorld()->getExterior(x, y)->count();
+                    if (!isDeferred(x, y))
+                        refsToLoad += MWBase::Environment::get().getWorld()->getExterior(x, y)->count();
                     cellsPositionsToLoad.push_back(std::make_pair(x, y));
                 }
             }
@@ -613,7 +639,7 @@ namespace MWWorld
             {
                 CellStore *cell = MWBase::Environment::get().getWorld()->getExterior(x, y);
 
-                loadCell (cell, loadingListener, changeEvent);
+                loadCell (cell, loadingListener, changeEvent, false, isDeferred(x, y));
             }
         }
 
@@ -763,6 +789,7 @@ namespace MWWorld
     , mPreloadDoors(Settings::Manager::getBool("preload doors", "Cells"))
     , mPreloadFastTravel(Settings::Manager::getBool("preload fast travel", "Cells"))
     , mPredictionTime(Settings::Manager::getFloat("prediction time", "Cells"))
+    , mInsertionBudget(std::max(0.f, Settings::Manager::getFloat("object insertion budget", "Cells")))
     {
         mPreloader.reset(new CellPreloader(rendering.getResourceSystem(), physics->getShapeManager(), rendering.getTerrain(), rendering.getLandManager()));
         mPreloader->setWorkQueue(mRendering.getWorkQueue());
@@ -892,6 +919,63 @@ namespace MWWorld
         cell.forEach (posVisitor);
     }
 
+    void Scene::queueCell (CellStore &cell)
+    {
+        // collect first, inserting may modify the cell (see InsertVisitor)
+        std::vector<Ptr> objects;
+        cell.forEach([&] (const Ptr& ptr) { objects.push_back(ptr); return true; });
+
+        // actors last, so that they are snapped to the ground after everything they could stand on is inserted
+        std::stable_partition(objects.begin(), objects.end(), [] (const Ptr& ptr) { return !ptr.getClass().isActor(); });
+
+        const int distance = std::abs(cell.getCell()->getGridX() - mCurrentGridCenter.x())
+            + std::abs(cell.getCell()->getGridY() - mCurrentGridCenter.y());
+
+        mPendingObjects.push(&cell, distance, std::move(objects));
+    }
+
+    void Scene::insertPendingObjects (bool useBudget)
+    {
+        if (mPendingObjects.empty())
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        const std::chrono::duration<float, std::milli> budget(mInsertionBudget);
+        LocalScripts& localScripts = MWBase::Environment::get().getWorld()->getLocalScripts();
+        std::vector<Ptr> inserted;
+
+        const auto insert = [&] (const Ptr& object)
+        {
+            // scripts of disabled references run as well, the same as for a cell inserted at once. Add them before
+            // inserting, to make sure we don't add scripts from levelled creature spawning twice.
+            localScripts.addObject(object);
+
+            inserted.push_back(object);
+
+            // may have been added in the meantime, e.g. by a script enabling it
+            if (object.getRefData().getBaseNode())
+                return;
+
+            insertObject(object, [&] (const MWWorld::Ptr& ptr) { addObject(ptr, *mPhysics, mRendering, mPagedRefs); });
+            insertObject(object, [&] (const MWWorld::Ptr& ptr) { addObject(ptr, *mPhysics, mNavigator); });
+        };
+
+        const auto isOverBudget = [&]
+        {
+            return useBudget && std::chrono::steady_clock::now() - start >= budget;
+        };
+
+        if (mPendingObjects.process(insert, isOverBudget) == 0)
+            return;
+
+        PositionVisitor posVisitor;
+        for (const Ptr& object : inserted)
+            posVisitor(object);
+
+        const auto player = MWBase::Environment::get().getWorld()->getPlayerPtr();
+        mNavigator.update(player.getRefData().getPosition().asVec3());
+    }
+
     void Scene::addObjectToScene (const Ptr& ptr)
     {
         try
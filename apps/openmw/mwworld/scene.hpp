@@ -6,6 +6,7 @@
 
 #include "ptr.hpp"
 #include "globals.hpp"
+#include "insertionqueue.hpp"
 
 #include <set>
 #include <memory>
@@ -92,11 +93,22 @@ namespace MWWorld
 
             std::set<ESM::RefNum> mPagedRefs;
 
+            // References of active cells that are still waiting to be inserted into the scene
+            InsertionQueue<CellStore*, Ptr> mPendingObjects;
+            float mInsertionBudget; // milliseconds per frame, 0 to insert whole cells at once
+
             void insertCell (CellStore &cell, Loading::Listener* loadingListener, bool test = false);
+            void queueCell (CellStore &cell);
+            void insertPendingObjects (bool useBudget);
+            ///< Insert queued references, stopping after the per-frame budget if \a useBudget is set.
+            /// Local scripts of queued references are added and actors are snapped to the ground as they are inserted.
             osg::Vec2i mCurrentGridCenter;
 
             // Load and unload cells as necessary to create a cell grid with "X" and "Y" in the center
-            void changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent = true);
+            // @param incremental Queue the references of cells other than the player's cell for
+            //                    insertion over the next frames.
+            void changeCellGrid (const osg::Vec3f &pos, int playerCellX, int playerCellY, bool changeEvent = true,
+                                 bool incremental = false);
 
             typedef std::pair<osg::Vec3f, osg::Vec4i> PositionCellGrid;
 
@@ -121,7 +133,9 @@ namespace MWWorld
 
             void unloadCell (CellStoreCollection::iterator iter, bool test = false);
 
-            void loadCell (CellStore *cell, Loading::Listener* loadingListener, bool respawn, bool test = false);
+            void loadCell (CellStore *cell, Loading::Listener* loadingListener, bool respawn, bool test = false,
+                           bool deferObjects = false);
+            ///< @param deferObjects Queue the references of the cell instead of inserting them right away.
 
             void playerMoved (const osg::Vec3f& pos);
 
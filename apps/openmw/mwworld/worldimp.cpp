@@ -25,6 +25,7 @@
 
 #include <components/sceneutil/positionattitudetransform.hpp>
 
+#include <components/detournavigator/asyncpathfinder.hpp>
 #include <components/detournavigator/debug.hpp>
 #include <components/detournavigator/navigatorimpl.hpp>
 #include <components/detournavigator/navigatorstub.hpp>
@@ -176,6 +177,7 @@ namespace MWWorld
 
         fillGlobalVariables();
 
+        mStore.setCellRefCacheSize(std::max(0, Settings::Manager::getInt("reference cache size", "Cells")));
         mStore.setUp(true);
         mStore.movePlayerRecord();
 
@@ -190,6 +192,8 @@ namespace MWWorld
             navigatorSettings->mSwimHeightScale = mSwimHeightScale;
             DetourNavigator::RecastGlobalAllocator::init();
             mNavigator.reset(new DetourNavigator::NavigatorImpl(*navigatorSettings));
+            if (navigatorSettings->mAsyncPathFinderThreads > 0)
+                mAsyncPathFinder.reset(new DetourNavigator::AsyncPathFinder(*mNavigator, navigatorSettings->mAsyncPathFinderThreads));
         }
         else
         {
@@ -198,6 +202,16 @@ namespace MWWorld
 
         mRendering.reset(new MWRender::RenderingManager(viewer, rootNode, resourceSystem, workQueue, resourcePath, *mNavigator));
         mProjectileManager.reset(new ProjectileManager(mRendering->getLightRoot(), resourceSystem, mRendering.get(), mPhysics.get()));
+
+        const std::string vertexCachePath = Settings::Manager::getString("prebaked vertex cache", "Terrain");
+        if (!vertexCachePath.empty())
+        {
+            std::vector<std::string> contentFilePaths;
+            for (const std::string& file : contentFiles)
+                contentFilePaths.push_back(fileCollections.getCollection(boost::filesystem::path(file).extension().string()).getPath(file).string());
+            mRendering->loadTerrainVertexCache(vertexCachePath, contentFilePaths);
+        }
+
         mRendering->preloadCommonAssets();
 
         mWeatherManager.reset(new MWWorld::WeatherManager(*mRendering, mStore));
@@ -783,9 +797,9 @@ namespace MWWorld
 
     void World::addContainerScripts(const Ptr& reference, CellStore * cell)
     {
-        if( reference.getTypeName()==typeid (ESM::Container).name() ||
-            reference.getTypeName()==typeid (ESM::NPC).name() ||
-            reference.getTypeName()==typeid (ESM::Creature).name())
+        if( reference.getType()==MWWorld::RefType::Container ||
+            reference.getType()==MWWorld::RefType::NPC ||
+            reference.getType()==MWWorld::RefType::Creature)
         {
             MWWorld::ContainerStore& container = reference.getClass().getContainerStore(reference);
             for(MWWorld::ContainerStoreIterator it = container.begin(); it != container.end(); ++it)
@@ -825,9 +839,9 @@ namespace MWWorld
 
     void World::removeContainerScripts(const Ptr& reference)
     {
-        if( reference.getTypeName()==typeid (ESM::Container).name() ||
-            reference.getTypeName()==typeid (ESM::NPC).name() ||
-            reference.getTypeName()==typeid (ESM::Creature).name())
+        if( reference.getType()==MWWorld::RefType::Container ||
+            reference.getType()==MWWorld::RefType::NPC ||
+            reference.getType()==MWWorld::RefType::Creature)
         {
             MWWorld::ContainerStore& container = reference.getClass().getContainerStore(reference);
             for(MWWorld::ContainerStoreIterator it = container.begin(); it != container.end(); ++it)
@@ -3392,7 +3406,7 @@ namespace MWWorld
                 return true;
 
             // Consider references inside containers as well (except if we are looking for a Creature, they cannot be in containers)
-            bool isContainer = ptr.getClass().getTypeName() == typeid(ESM::Container).name();
+            bool isContainer = ptr.getClass().getType() == MWWorld::RefType::Container;
             if (mType != World::Detect_Creature && (ptr.getClass().isActor() || isContainer))
             {
                 // but ignore containers without resolved content
@@ -3425,10 +3439,10 @@ namespace MWWorld
                 // If in werewolf form, this detects only NPCs, otherwise only creatures
                 if (detector.getClass().isNpc() && detector.getClass().getNpcStats(detector).isWerewolf())
                 {
-                    if (ptr.getClass().getTypeName() != typeid(ESM::NPC).name())
+                    if (ptr.getClass().getType() != MWWorld::RefType::NPC)
                         return false;
                 }
-                else if (ptr.getClass().getTypeName() != typeid(ESM::Creature).name())
+                else if (ptr.getClass().getType() != MWWorld::RefType::Creature)
                     return false;
 
                 if (ptr.getClass().getCreatureStats(ptr).isDead())
@@ -3855,6 +3869,11 @@ namespace MWWorld
         return mNavigator.get();
     }
 
+    DetourNavigator::AsyncPathFinder* World::getAsyncPathFinder() const
+    {
+        return mAsyncPathFinder.get();
+    }
+
     void World::updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
             const osg::Vec3f& halfExtents, const osg::Vec3f& start, const osg::Vec3f& end) const
     {
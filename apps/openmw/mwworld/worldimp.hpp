@@ -93,6 +93,7 @@ namespace MWWorld
             std::unique_ptr<MWWorld::Player> mPlayer;
             std::unique_ptr<MWPhysics::PhysicsSystem> mPhysics;
             std::unique_ptr<DetourNavigator::Navigator> mNavigator;
+            std::unique_ptr<DetourNavigator::AsyncPathFinder> mAsyncPathFinder;
             std::unique_ptr<MWRender::RenderingManager> mRendering;
             std::unique_ptr<MWWorld::Scene> mWorldScene;
             std::unique_ptr<MWWorld::WeatherManager> mWeatherManager;
@@ -722,6 +723,8 @@ namespace MWWorld
 
             DetourNavigator::Navigator* getNavigator() const override;
 
+            DetourNavigator::AsyncPathFinder* getAsyncPathFinder() const override;
+
             void updateActorPath(const MWWorld::ConstPtr& actor, const std::deque<osg::Vec3f>& path,
                     const osg::Vec3f& halfExtents, const osg::Vec3f& start, const osg::Vec3f& end) const override;
 
@@ -1,5 +1,6 @@
 #include "operators.hpp"
 
+#include <components/detournavigator/asyncpathfinder.hpp>
 #include <components/detournavigator/navigatorimpl.hpp>
 #include <components/detournavigator/exceptions.hpp>
 #include <components/misc/rng.hpp>
@@ -12,6 +13,7 @@
 #include <gmock/gmock.h>
 
 #include <deque>
+#include <thread>
 
 MATCHER_P3(Vec3fEq, x, y, z, "")
 {
@@ -802,4 +804,41 @@ namespace
         EXPECT_GT(duration, mSettings.mMinUpdateInterval)
             << std::chrono::duration_cast<std::chrono::duration<float, std::milli>>(duration).count() << " ms";
     }
+
+    TEST_F(DetourNavigatorNavigatorTest, async_find_path_for_empty_should_be_done_with_nav_mesh_not_found)
+    {
+        AsyncPathFinder asyncPathFinder(*mNavigator, 1);
+        const auto request = asyncPathFinder.post(PathQuery {mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts});
+        EXPECT_TRUE(request->isDone());
+        EXPECT_EQ(request->getStatus(), Status::NavMeshNotFound);
+        EXPECT_EQ(request->getPath(), std::deque<osg::Vec3f>());
+    }
+
+    TEST_F(DetourNavigatorNavigatorTest, async_find_path_should_return_same_path_as_find_path)
+    {
+        const std::array<btScalar, 5 * 5> heightfieldData {{
+            0,   0,    0,    0,    0,
+            0, -25,  -25,  -25,  -25,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+            0, -25, -100, -100, -100,
+        }};
+        btHeightfieldTerrainShape shape(5, 5, heightfieldData.data(), 1, 0, 0, 2, PHY_FLOAT, false);
+        shape.setLocalScaling(btVector3(128, 128, 1));
+
+        mNavigator->addAgent(mAgentHalfExtents);
+        mNavigator->addObject(ObjectId(&shape), shape, btTransform::getIdentity());
+        mNavigator->update(mPlayerPosition);
+        mNavigator->wait();
+
+        EXPECT_EQ(mNavigator->findPath(mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts, mOut), Status::Success);
+
+        AsyncPathFinder asyncPathFinder(*mNavigator, 2);
+        const auto request = asyncPathFinder.post(PathQuery {mAgentHalfExtents, mStepSize, mStart, mEnd, Flag_walk, mAreaCosts});
+        while (!request->isDone())
+            std::this_thread::yield();
+
+        EXPECT_EQ(request->getStatus(), Status::Success);
+        EXPECT_EQ(request->getPath(), mPath);
+    }
 }
@@ -51,3 +51,15 @@ TEST_F (PartialBinarySearchTest, ci_test)
     std::string unicode1 = "\u04151 \u0418"; // CYRILLIC CAPITAL LETTER IE, CYRILLIC CAPITAL LETTER I
     EXPECT_TRUE( Misc::StringUtils::lowerCase(unicode1) == unicode1 );
 }
+
+TEST (StringOpsTest, ci_hash_should_match_ci_equal)
+{
+    const Misc::StringUtils::CiHash hash;
+    const Misc::StringUtils::CiEqual equal;
+
+    EXPECT_TRUE (equal("Bip01 Head", "bip01 HEAD"));
+    EXPECT_EQ (hash("Bip01 Head"), hash("bip01 HEAD"));
+
+    EXPECT_FALSE (equal("Bip01 Head", "Bip01 Head "));
+    EXPECT_NE (hash("Bip01 Head"), hash("Bip01 Heae"));
+}
@@ -0,0 +1,66 @@
+#include "apps/openmw/mwworld/findreplacement.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+
+    struct Stack
+    {
+        int mCount;
+        int mHealth;
+    };
+
+    struct MWWorldFindReplacementTest : Test
+    {
+        std::vector<Stack> mStacks;
+
+        std::vector<Stack>::const_iterator find() const
+        {
+            return MWWorld::findReplacement(mStacks.begin(), mStacks.end(),
+                [] (const Stack& stack) { return stack.mCount; },
+                [] (const Stack& stack) { return stack.mHealth; });
+        }
+    };
+
+    TEST_F(MWWorldFindReplacementTest, should_return_end_without_stacks)
+    {
+        EXPECT_EQ(find(), mStacks.end());
+    }
+
+    TEST_F(MWWorldFindReplacementTest, should_return_end_when_all_stacks_are_empty)
+    {
+        mStacks = {{0, 1}, {0, 5}};
+        EXPECT_EQ(find(), mStacks.end());
+    }
+
+    TEST_F(MWWorldFindReplacementTest, should_skip_empty_stack_earlier_in_the_list)
+    {
+        mStacks = {{0, 1}, {2, 1}};
+        EXPECT_EQ(find(), mStacks.begin() + 1);
+    }
+
+    TEST_F(MWWorldFindReplacementTest, should_skip_empty_stack_with_fewer_uses)
+    {
+        mStacks = {{1, 10}, {0, 2}, {1, 5}};
+        EXPECT_EQ(find(), mStacks.begin() + 2);
+    }
+
+    TEST_F(MWWorldFindReplacementTest, should_prefer_stack_with_fewest_uses_left)
+    {
+        mStacks = {{1, 10}, {1, 3}, {1, 5}};
+        EXPECT_EQ(find(), mStacks.begin() + 1);
+    }
+
+    TEST_F(MWWorldFindReplacementTest, should_pick_used_up_stack_only_without_alternative)
+    {
+        mStacks = {{1, 0}, {1, 7}};
+        EXPECT_EQ(find(), mStacks.begin() + 1);
+
+        mStacks = {{1, 0}, {0, 7}};
+        EXPECT_EQ(find(), mStacks.begin());
+    }
+}
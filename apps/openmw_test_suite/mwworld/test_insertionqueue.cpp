@@ -0,0 +1,122 @@
+#include "apps/openmw/mwworld/insertionqueue.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace testing;
+    using namespace MWWorld;
+
+    struct MWWorldInsertionQueueTest : Test
+    {
+        InsertionQueue<std::string, int> mQueue;
+        std::vector<int> mInserted;
+
+        std::size_t process(std::size_t budget)
+        {
+            const std::size_t before = mInserted.size();
+            return mQueue.process([&] (int object) { mInserted.push_back(object); },
+                                  [&] { return mInserted.size() - before >= budget; });
+        }
+
+        std::size_t processAll()
+        {
+            return mQueue.process([&] (int object) { mInserted.push_back(object); }, [] { return false; });
+        }
+    };
+
+    TEST_F(MWWorldInsertionQueueTest, should_be_empty_by_default)
+    {
+        EXPECT_TRUE(mQueue.empty());
+        EXPECT_EQ(processAll(), 0u);
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_insert_all_objects_without_budget)
+    {
+        mQueue.push("a", 1, {1, 2, 3});
+        EXPECT_EQ(processAll(), 3u);
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 3));
+        EXPECT_TRUE(mQueue.empty());
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_insert_farther_cells_first)
+    {
+        mQueue.push("near", 1, {1});
+        mQueue.push("far", 2, {2});
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(2, 1));
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_keep_push_order_for_same_distance)
+    {
+        mQueue.push("a", 1, {1});
+        mQueue.push("b", 1, {2});
+        mQueue.push("c", 1, {3});
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 3));
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_stop_when_over_budget_and_continue_on_next_call)
+    {
+        mQueue.push("a", 1, {1, 2, 3});
+        mQueue.push("b", 1, {4, 5});
+        EXPECT_EQ(process(2), 2u);
+        EXPECT_THAT(mInserted, ElementsAre(1, 2));
+        EXPECT_EQ(process(2), 2u);
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 3, 4));
+        EXPECT_FALSE(mQueue.empty());
+        EXPECT_EQ(process(2), 1u);
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 3, 4, 5));
+        EXPECT_TRUE(mQueue.empty());
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_insert_one_object_per_call_when_budget_is_exceeded)
+    {
+        mQueue.push("a", 1, {1, 2});
+        EXPECT_EQ(mQueue.process([&] (int object) { mInserted.push_back(object); }, [] { return true; }), 1u);
+        EXPECT_THAT(mInserted, ElementsAre(1));
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_finish_partially_inserted_cell_before_farther_one)
+    {
+        mQueue.push("near", 1, {1, 2});
+        process(1);
+        mQueue.push("far", 2, {3});
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 3));
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_put_farther_cell_before_waiting_ones)
+    {
+        mQueue.push("near", 1, {1, 2});
+        mQueue.push("nearer", 0, {3});
+        process(1);
+        mQueue.push("far", 2, {4});
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(1, 2, 4, 3));
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_not_insert_objects_of_erased_cell)
+    {
+        mQueue.push("a", 1, {1, 2});
+        mQueue.push("b", 1, {3});
+        process(1);
+        mQueue.erase("a");
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(1, 3));
+        EXPECT_TRUE(mQueue.empty());
+    }
+
+    TEST_F(MWWorldInsertionQueueTest, should_skip_cells_without_objects)
+    {
+        mQueue.push("a", 1, {});
+        mQueue.push("b", 1, {1});
+        processAll();
+        EXPECT_THAT(mInserted, ElementsAre(1));
+        EXPECT_TRUE(mQueue.empty());
+    }
+}
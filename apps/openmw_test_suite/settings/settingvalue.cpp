@@ -0,0 +1,91 @@
+#include <components/settings/settingvalue.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    using namespace testing;
+    using namespace Settings;
+
+    /// Counts how often Manager asks it to update, instead of parsing a value
+    struct CountingSettingValue final : BaseSettingValue
+    {
+        int& mUpdates;
+
+        CountingSettingValue(const std::string& setting, const std::string& category, int& updates)
+            : BaseSettingValue(setting, category)
+            , mUpdates(updates)
+        {
+            Manager::registerValue(this);
+        }
+
+        ~CountingSettingValue() override
+        {
+            Manager::unregisterValue(this);
+        }
+
+        void update() override
+        {
+            ++mUpdates;
+        }
+    };
+
+    struct SettingsSettingValueTest : Test
+    {
+        SettingsSettingValueTest()
+        {
+            Manager::mDefaultSettings[{"Category", "float"}] = "0.5";
+            Manager::mDefaultSettings[{"Category", "int"}] = "3";
+            Manager::mDefaultSettings[{"Category", "bool"}] = "true";
+        }
+
+        ~SettingsSettingValueTest()
+        {
+            Manager().clear();
+        }
+    };
+
+    TEST_F(SettingsSettingValueTest, should_parse_current_value)
+    {
+        const SettingValue<float> floatValue("float", "Category");
+        const SettingValue<int> intValue("int", "Category");
+        const SettingValue<bool> boolValue("bool", "Category");
+
+        EXPECT_EQ(floatValue.get(), 0.5f);
+        EXPECT_EQ(intValue.get(), 3);
+        EXPECT_EQ(boolValue.get(), true);
+    }
+
+    TEST_F(SettingsSettingValueTest, should_follow_changes_of_setting)
+    {
+        const SettingValue<float> value("float", "Category");
+        const SettingValue<float> other("float", "Category");
+
+        Manager::setFloat("float", "Category", 2.f);
+
+        EXPECT_EQ(value.get(), 2.f);
+        EXPECT_EQ(other.get(), 2.f);
+    }
+
+    TEST_F(SettingsSettingValueTest, should_not_be_updated_after_destruction)
+    {
+        int destroyedUpdates = 0;
+        {
+            const CountingSettingValue destroyed("int", "Category", destroyedUpdates);
+        }
+        int liveUpdates = 0;
+        const CountingSettingValue live("int", "Category", liveUpdates);
+        const SettingValue<int> value("int", "Category");
+
+        Manager::setInt("int", "Category", 4);
+
+        EXPECT_EQ(destroyedUpdates, 0);
+        EXPECT_EQ(liveUpdates, 1);
+        EXPECT_EQ(value.get(), 4);
+    }
+
+    TEST_F(SettingsSettingValueTest, should_throw_for_missing_setting)
+    {
+        EXPECT_THROW(SettingValue<int>("missing", "Category"), std::runtime_error);
+    }
+}
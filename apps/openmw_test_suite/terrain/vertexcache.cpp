@@ -0,0 +1,163 @@
+#include <components/terrain/vertexcache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <sstream>
+
+namespace
+{
+    using namespace testing;
+    using namespace Terrain;
+
+    struct TerrainVertexCacheTest : Test
+    {
+        const std::vector<VertexCache::ContentFile> mContentFiles {
+            {"Morrowind.esm", 79837557, 1024000000},
+            {"Tribunal.esm", 4565686, 1034000000},
+        };
+        const int mVertexLodMod = 1;
+        const osg::Vec2f mCenter {2.5f, -1.5f};
+        osg::Vec3Array mPositions;
+        osg::Vec3Array mNormals;
+        osg::Vec4ubArray mColours;
+
+        TerrainVertexCacheTest()
+        {
+            // 3 x 3 vertices
+            for (int i = 0; i < 9; ++i)
+            {
+                mPositions.push_back(osg::Vec3f(0, 0, i * 10.f));
+                mNormals.push_back(osg::Vec3f(0, 0, 1));
+                mColours.push_back(osg::Vec4ub(i, 2 * i, 3 * i, 255));
+            }
+        }
+
+        std::unique_ptr<std::istream> write(const std::vector<VertexCache::ContentFile>& contentFiles, int vertexLodMod)
+        {
+            VertexCache cache(8192.f, vertexLodMod);
+            cache.setContentFiles(contentFiles);
+            cache.addChunk(0, 1.f, mCenter, mPositions, mNormals, mColours);
+            auto stream = std::make_unique<std::stringstream>();
+            cache.write(*stream);
+            return stream;
+        }
+    };
+
+    TEST_F(TerrainVertexCacheTest, should_read_written_chunks)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        EXPECT_EQ(cache.getNumChunks(), 1u);
+        EXPECT_EQ(cache.getCellWorldSize(), 8192.f);
+        EXPECT_EQ(cache.getVertexLodMod(), mVertexLodMod);
+
+        osg::Vec3Array positions;
+        osg::Vec3Array normals;
+        osg::Vec4ubArray colours;
+        ASSERT_TRUE(cache.fillVertexBuffers(0, 1.f, mCenter, positions, normals, colours));
+        ASSERT_EQ(positions.size(), mPositions.size());
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            EXPECT_EQ(positions[i].z(), mPositions[i].z());
+            EXPECT_FLOAT_EQ(normals[i].z(), 1.f);
+            for (int j = 0; j < 3; ++j)
+                EXPECT_EQ(colours[i][j], mColours[i][j]);
+        }
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_not_fill_missing_chunks)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+
+        osg::Vec3Array positions;
+        osg::Vec3Array normals;
+        osg::Vec4ubArray colours;
+        EXPECT_FALSE(cache.fillVertexBuffers(1, 1.f, mCenter, positions, normals, colours));
+        EXPECT_FALSE(cache.fillVertexBuffers(0, 2.f, mCenter, positions, normals, colours));
+        EXPECT_TRUE(positions.empty());
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_accept_same_content_files_and_vertex_lod_mod)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        EXPECT_NO_THROW(cache.validate(mContentFiles, mVertexLodMod));
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_compare_content_file_names_case_insensitive)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        auto contentFiles = mContentFiles;
+        contentFiles[0].mName = "morrowind.ESM";
+        EXPECT_NO_THROW(cache.validate(contentFiles, mVertexLodMod));
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_reject_other_vertex_lod_mod)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        EXPECT_THROW(cache.validate(mContentFiles, mVertexLodMod + 1), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_reject_other_number_of_content_files)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        auto contentFiles = mContentFiles;
+        contentFiles.push_back({"Bloodmoon.esm", 9631798, 1055000000});
+        EXPECT_THROW(cache.validate(contentFiles, mVertexLodMod), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_reject_other_content_file_order)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        const std::vector<VertexCache::ContentFile> contentFiles {mContentFiles[1], mContentFiles[0]};
+        EXPECT_THROW(cache.validate(contentFiles, mVertexLodMod), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_reject_content_file_with_other_size)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        auto contentFiles = mContentFiles;
+        ++contentFiles[1].mSize;
+        EXPECT_THROW(cache.validate(contentFiles, mVertexLodMod), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_reject_content_file_with_other_modification_time)
+    {
+        VertexCache cache;
+        cache.open(write(mContentFiles, mVertexLodMod));
+        auto contentFiles = mContentFiles;
+        ++contentFiles[1].mModificationTime;
+        EXPECT_THROW(cache.validate(contentFiles, mVertexLodMod), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_throw_for_other_data)
+    {
+        VertexCache cache;
+        EXPECT_THROW(cache.open(std::make_unique<std::istringstream>("OTVD")), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_throw_for_unsupported_version)
+    {
+        auto stream = write(mContentFiles, mVertexLodMod);
+        std::string data(std::istreambuf_iterator<char>(*stream), {});
+        data[4] = 1;
+        VertexCache cache;
+        EXPECT_THROW(cache.open(std::make_unique<std::istringstream>(data)), std::runtime_error);
+    }
+
+    TEST_F(TerrainVertexCacheTest, should_throw_for_truncated_header)
+    {
+        auto stream = write(mContentFiles, mVertexLodMod);
+        std::string data(std::istreambuf_iterator<char>(*stream), {});
+        data.resize(20);
+        VertexCache cache;
+        EXPECT_THROW(cache.open(std::make_unique<std::istringstream>(data)), std::runtime_error);
+    }
+}
@@ -0,0 +1,309 @@
+///Program to generate the vertex data of distant terrain chunks ahead of time.
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+#include <components/esm/esmreader.hpp>
+#include <components/esm/loadland.hpp>
+#include <components/esmterrain/storage.hpp>
+#include <components/terrain/quadtreeworld.hpp>
+#include <components/terrain/vertexcache.hpp>
+#include <components/to_utf8/to_utf8.hpp>
+
+#define TERRAINBAKE_VERSION 1.0
+
+// Create local aliases for brevity
+namespace bpo = boost::program_options;
+namespace bfs = boost::filesystem;
+
+struct Arguments
+{
+    std::vector<std::string> files;
+    std::string output;
+    std::string encoding;
+    float minSize;
+    int vertexLodMod;
+};
+
+/// Terrain storage over the land records of the given content files, later files overriding earlier ones.
+class BakeStorage : public ESMTerrain::Storage
+{
+public:
+    BakeStorage()
+        : ESMTerrain::Storage(nullptr)
+    {
+    }
+
+    void addLand(const ESM::Land& land)
+    {
+        mLands[std::make_pair(land.mX, land.mY)] = land;
+    }
+
+    void removeLand(int cellX, int cellY)
+    {
+        mLands.erase(std::make_pair(cellX, cellY));
+    }
+
+    std::size_t getNumLands() const
+    {
+        return mLands.size();
+    }
+
+    bool hasData(int cellX, int cellY) override
+    {
+        return mLands.count(std::make_pair(cellX, cellY)) != 0;
+    }
+
+    /// Land data is loaded again for every chunk, so that memory use does not grow with the size of the world.
+    osg::ref_ptr<const ESMTerrain::LandObject> getLand(int cellX, int cellY) override
+    {
+        const auto found = mLands.find(std::make_pair(cellX, cellY));
+        if (found == mLands.end())
+            return nullptr;
+        return new ESMTerrain::LandObject(&found->second, ESM::Land::DATA_VHGT | ESM::Land::DATA_VNML | ESM::Land::DATA_VCLR);
+    }
+
+    const ESM::LandTexture* getLandTexture(int index, short plugin) override
+    {
+        return nullptr;
+    }
+
+    void getBounds(float& minX, float& maxX, float& minY, float& maxY) override
+    {
+        minX = 0, minY = 0, maxX = 0, maxY = 0;
+        for (const auto& land : mLands)
+        {
+            minX = std::min(minX, static_cast<float>(land.first.first));
+            maxX = std::max(maxX, static_cast<float>(land.first.first));
+            minY = std::min(minY, static_cast<float>(land.first.second));
+            maxY = std::max(maxY, static_cast<float>(land.first.second));
+        }
+
+        // since grid coords are at cell origin, we need to add 1 cell
+        maxX += 1;
+        maxY += 1;
+    }
+
+private:
+    std::map<std::pair<int, int>, ESM::Land> mLands;
+};
+
+bool parseOptions (int argc, char** argv, Arguments &info)
+{
+    bpo::options_description desc("Generate the vertex data of distant terrain chunks ahead of time\n\n"
+            "Usages:\n"
+            "  terrainbake -o outputfile <content files in load order>\n"
+            "      Write the vertex data of terrain chunks to the output file, which can be used\n"
+            "      through the 'prebaked vertex cache' setting.\n\n"
+            "Allowed options");
+
+    desc.add_options()
+        ("help,h", "print help message.")
+        ("version,v", "print version information and quit.")
+        ("output,o", bpo::value<std::string>(), "output file")
+        ("encoding,e", bpo::value<std::string>()->default_value("win1252"),
+            "Character encoding used in OpenMW game messages:\n"
+            "\n\twin1250 - Central and Eastern European such as Polish, Czech, Slovak, Hungarian, Slovene, Bosnian, Croatian, Serbian (Latin script), Romanian and Albanian languages\n"
+            "\n\twin1251 - Cyrillic alphabet such as Russian, Bulgarian, Serbian Cyrillic and other languages\n"
+            "\n\twin1252 - Western European (Latin) alphabet, used by default")
+        ("min-size", bpo::value<float>()->default_value(4.f),
+            "smallest chunk size in cells to generate, smaller chunks are left to the engine")
+        ("vertex-lod-mod", bpo::value<int>()->default_value(0),
+            "same as the 'vertex lod mod' setting the engine is run with")
+        ;
+
+    // input-file is hidden and used as a positional argument
+    bpo::options_description hidden("Hidden Options");
+
+    hidden.add_options()
+        ( "input-file,i", bpo::value< std::vector<std::string> >(), "input file")
+        ;
+
+    bpo::positional_options_description p;
+    p.add("input-file", -1);
+
+    bpo::options_description all;
+    all.add(desc).add(hidden);
+
+    bpo::variables_map variables;
+    try
+    {
+        bpo::parsed_options valid_opts = bpo::command_line_parser(argc, argv)
+            .options(all).positional(p).run();
+        bpo::store(valid_opts, variables);
+        bpo::notify(variables);
+    }
+    catch(std::exception &e)
+    {
+        std::cout << "ERROR parsing arguments: " << e.what() << "\n\n"
+            << desc << std::endl;
+        return false;
+    }
+
+    if (variables.count ("help"))
+    {
+        std::cout << desc << std::endl;
+        return false;
+    }
+    if (variables.count ("version"))
+    {
+        std::cout << "Terrainbake version " << TERRAINBAKE_VERSION << std::endl;
+        return false;
+    }
+    if (!variables.count("input-file"))
+    {
+        std::cout << "No content files specified!\n\n" << desc << std::endl;
+        return false;
+    }
+    if (!variables.count("output"))
+    {
+        std::cout << "No output file specified!\n\n" << desc << std::endl;
+        return false;
+    }
+
+    info.files = variables["input-file"].as< std::vector<std::string> >();
+    info.output = variables["output"].as<std::string>();
+    info.encoding = variables["encoding"].as<std::string>();
+    info.minSize = std::max(1.f, variables["min-size"].as<float>());
+    info.vertexLodMod = variables["vertex-lod-mod"].as<int>();
+
+    return true;
+}
+
+void loadLands(const Arguments& info, BakeStorage& storage)
+{
+    ToUTF8::Utf8Encoder encoder (ToUTF8::calculateEncoding(info.encoding));
+
+    for (std::size_t i = 0; i < info.files.size(); ++i)
+    {
+        std::cout << "Loading file: " << info.files[i] << std::endl;
+
+        ESM::ESMReader esm;
+        esm.setEncoder(&encoder);
+        esm.setIndex(static_cast<int>(i));
+        esm.open(info.files[i]);
+
+        while (esm.hasMoreRecs())
+        {
+            ESM::NAME n = esm.getRecName();
+            esm.getRecHeader();
+
+            if (n.intval != ESM::REC_LAND)
+            {
+                esm.skipRecord();
+                continue;
+            }
+
+            ESM::Land land;
+            bool isDeleted = false;
+            land.load(esm, isDeleted);
+
+            if (isDeleted)
+                storage.removeLand(land.mX, land.mY);
+            else
+                storage.addLand(land);
+        }
+    }
+}
+
+/// Walk the same quad tree as Terrain::QuadTreeWorld and bake every chunk that is at least minSize cells large.
+void bakeChunks(BakeStorage& storage, const Arguments& info, Terrain::VertexCache& cache)
+{
+    float minX, maxX, minY, maxY;
+    storage.getBounds(minX, maxX, minY, maxY);
+
+    int origSizeX = static_cast<int>(maxX - minX);
+    int origSizeY = static_cast<int>(maxY - minY);
+
+    // Dividing a quad tree only works well for powers of two, so round up to the nearest one
+    int size = 1;
+    while (size < std::max(origSizeX, origSizeY))
+        size *= 2;
+
+    float centerX = (minX+maxX)/2.f + (size-origSizeX)/2.f;
+    float centerY = (minY+maxY)/2.f + (size-origSizeY)/2.f;
+
+    struct Chunk
+    {
+        float mSize;
+        osg::Vec2f mCenter;
+    };
+
+    std::vector<Chunk> stack {Chunk {static_cast<float>(size), osg::Vec2f(centerX, centerY)}};
+    while (!stack.empty())
+    {
+        const Chunk chunk = stack.back();
+        stack.pop_back();
+
+        const float halfSize = chunk.mSize / 2.f;
+        if (chunk.mCenter.x() - halfSize > maxX || chunk.mCenter.x() + halfSize < minX
+                || chunk.mCenter.y() - halfSize > maxY || chunk.mCenter.y() + halfSize < minY)
+            continue;
+
+        bool hasData = false;
+        for (int cellY = static_cast<int>(chunk.mCenter.y() - halfSize); !hasData && cellY < chunk.mCenter.y() + halfSize; ++cellY)
+            for (int cellX = static_cast<int>(chunk.mCenter.x() - halfSize); !hasData && cellX < chunk.mCenter.x() + halfSize; ++cellX)
+                hasData = storage.hasData(cellX, cellY);
+        if (!hasData)
+            continue;
+
+        const int lod = static_cast<int>(Terrain::getVertexLod(chunk.mSize, info.vertexLodMod));
+
+        osg::ref_ptr<osg::Vec3Array> positions (new osg::Vec3Array);
+        osg::ref_ptr<osg::Vec3Array> normals (new osg::Vec3Array);
+        osg::ref_ptr<osg::Vec4ubArray> colours (new osg::Vec4ubArray);
+        storage.fillVertexBuffers(lod, chunk.mSize, chunk.mCenter, positions, normals, colours);
+        cache.addChunk(lod, chunk.mSize, chunk.mCenter, *positions, *normals, *colours);
+
+        if (halfSize < info.minSize)
+            continue;
+
+        const float quarterSize = halfSize / 2.f;
+        stack.push_back(Chunk {halfSize, chunk.mCenter + osg::Vec2f(-quarterSize, -quarterSize)});
+        stack.push_back(Chunk {halfSize, chunk.mCenter + osg::Vec2f(quarterSize, -quarterSize)});
+        stack.push_back(Chunk {halfSize, chunk.mCenter + osg::Vec2f(-quarterSize, quarterSize)});
+        stack.push_back(Chunk {halfSize, chunk.mCenter + osg::Vec2f(quarterSize, quarterSize)});
+    }
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        Arguments info;
+        if (!parseOptions (argc, argv, info))
+            return 1;
+
+        BakeStorage storage;
+        loadLands(info, storage);
+        std::cout << "Loaded " << storage.getNumLands() << " land records" << std::endl;
+
+        Terrain::VertexCache cache(storage.getCellWorldSize(), info.vertexLodMod);
+
+        std::vector<Terrain::VertexCache::ContentFile> contentFiles;
+        for (const std::string& file : info.files)
+            contentFiles.push_back(Terrain::VertexCache::ContentFile::fromPath(file));
+        cache.setContentFiles(contentFiles);
+
+        bakeChunks(storage, info, cache);
+
+        bfs::ofstream stream(bfs::path(info.output), std::ios::binary);
+        cache.write(stream);
+        if (!stream)
+            throw std::runtime_error("Failed to write " + info.output);
+
+        std::cout << "Wrote " << cache.getNumChunks() << " terrain chunks to " << info.output << std::endl;
+    }
+    catch (std::exception& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -259,6 +259,10 @@ static void crash_catcher(int signum, siginfo_t *siginfo, void *context)
     if(cc_user_info)
         cc_user_info(crash_info.buf, crash_info.buf+sizeof(crash_info.buf));
 
+    /* Give the log writer thread a chance to write out the lines logged right before the crash.
+     * Bounded, since the crash may have happened on that thread or while it held its lock. */
+    Debug::waitForLogWriter(1000);
+
     /* Fork off to start a crash handler */
     switch((dbg_pid=fork()))
     {
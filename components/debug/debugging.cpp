@@ -131,6 +131,9 @@ int wrapApplication(int (*innerApplication)(int argc, char *argv[]), int argc, c
         std::cerr.rdbuf (&cerrsb);
 #endif
 
+        // Each line still goes to the log file and the console, but writing it no longer stalls the logging thread
+        Debug::startLogWriter();
+
         // install the crash handler as soon as possible. note that the log path
         // does not depend on config being read.
         crashCatcherInstall(argc, argv, (cfgMgr.getLogPath() / crashLogName).string());
@@ -149,6 +152,9 @@ int wrapApplication(int (*innerApplication)(int argc, char *argv[]), int argc, c
         ret = 1;
     }
 
+    // Write out whatever is still queued while cout is redirected
+    Debug::stopLogWriter();
+
     // Restore cout and cerr
     std::cout.rdbuf(cout_rdbuf);
     std::cerr.rdbuf(cerr_rdbuf);
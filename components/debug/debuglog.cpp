@@ -1,8 +1,126 @@
 #include "debuglog.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace Debug
 {
     Level CurrentDebugLevel = Level::NoLevel;
-}
 
-std::mutex Log::sLock;
+    namespace
+    {
+        /// Writes lines handed over by any thread to cout, in the order they were handed over.
+        /// Producers only append to a vector under a short lock; all stream I/O is done by the writer thread.
+        class LogWriter
+        {
+        public:
+            LogWriter()
+                : mStop(false)
+                , mThread([this] { run(); })
+            {
+            }
+
+            ~LogWriter()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mStop = true;
+                }
+                mCondition.notify_one();
+                mThread.join();
+            }
+
+            void push(std::string&& line)
+            {
+                ++mPending;
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mQueue.push_back(std::move(line));
+                }
+                mCondition.notify_one();
+            }
+
+            bool hasPending() const
+            {
+                return mPending.load() != 0;
+            }
+
+        private:
+            void run()
+            {
+                std::vector<std::string> lines;
+                std::unique_lock<std::mutex> lock(mMutex);
+                while (true)
+                {
+                    mCondition.wait(lock, [this] { return mStop || !mQueue.empty(); });
+                    if (mQueue.empty())
+                        return;
+
+                    lines.swap(mQueue);
+                    lock.unlock();
+
+                    // One flush per line, so every write reaching the Tee starts with its level marker
+                    for (const std::string& line : lines)
+                        std::cout << line << std::endl;
+                    mPending -= lines.size();
+                    lines.clear();
+
+                    lock.lock();
+                }
+            }
+
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+            std::vector<std::string> mQueue;
+            std::atomic<std::size_t> mPending {0};
+            bool mStop;
+            std::thread mThread;
+        };
+
+        // Guards the lifetime of the writer, and cout while there is none. Never held during I/O otherwise.
+        std::mutex sWriterMutex;
+
+        // Not an owning static object: if the process exits without stopLogWriter(), a joinable std::thread
+        // would otherwise be destroyed during static destruction and terminate the process.
+        // Atomic only for waitForLogWriter(), which can not lock.
+        std::atomic<LogWriter*> sWriter {nullptr};
+    }
+
+    void startLogWriter()
+    {
+        std::lock_guard<std::mutex> lock(sWriterMutex);
+        if (sWriter.load() == nullptr)
+            sWriter = new LogWriter;
+    }
+
+    void stopLogWriter()
+    {
+        std::lock_guard<std::mutex> lock(sWriterMutex);
+        // The destructor writes out everything that was pushed before
+        delete sWriter.exchange(nullptr);
+    }
+
+    void waitForLogWriter(int timeoutMs)
+    {
+        const LogWriter* writer = sWriter.load();
+        if (writer == nullptr)
+            return;
+
+        for (int i = 0; i < timeoutMs && writer->hasPending(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    void writeLogLine(std::string&& line)
+    {
+        std::lock_guard<std::mutex> lock(sWriterMutex);
+        if (LogWriter* writer = sWriter.load())
+            writer->push(std::move(line));
+        else
+            std::cout << line << std::endl;
+    }
+}
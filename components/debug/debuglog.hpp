@@ -3,6 +3,8 @@
 
 #include <mutex>
 #include <iostream>
+#include <sstream>
+#include <string>
 
 #include <osg/io_utils>
 
@@ -21,18 +23,29 @@ namespace Debug
     };
 
     extern Level CurrentDebugLevel;
+
+    /// Write finished log lines to cout on a background thread from now on, instead of on the thread that logged them.
+    /// @note Lines are written in the order they were finished, so the order of lines from any one thread is kept.
+    void startLogWriter();
+
+    /// Write out all pending log lines, stop the background thread and go back to writing lines on the thread that logs them.
+    void stopLogWriter();
+
+    /// Wait up to \a timeoutMs milliseconds for the background thread to write out all pending log lines.
+    /// @note Only polls an atomic counter and sleeps, so it is safe to call from a signal handler.
+    void waitForLogWriter(int timeoutMs);
+
+    /// Hand a finished line (including its level marker) over to be written.
+    void writeLogLine(std::string&& line);
 }
 
 class Log
 {
-    static std::mutex sLock;
-
-    std::unique_lock<std::mutex> mLock;
 public:
-    // Locks a global lock while the object is alive
+    // Formats the message in a buffer of the calling thread, without taking any lock
     Log(Debug::Level level) :
-    mLock(sLock),
-    mLevel(level)
+    mLevel(level),
+    mStream(getStream())
     {
         // If the app has no logging system enabled, log level is not specified.
         // Show all messages without marker - we just use the plain cout in this case.
@@ -40,27 +53,44 @@ public:
             return;
 
         if (mLevel <= Debug::CurrentDebugLevel)
-            std::cout << static_cast<unsigned char>(mLevel);
+            mStream << static_cast<unsigned char>(mLevel);
     }
 
-    // Perfect forwarding wrappers to give the chain of objects to cout
+    // Perfect forwarding wrappers to give the chain of objects to the line buffer
     template<typename T>
     Log& operator<<(T&& rhs)
     {
         if (mLevel <= Debug::CurrentDebugLevel)
-            std::cout << std::forward<T>(rhs);
+            mStream << std::forward<T>(rhs);
 
         return *this;
     }
 
     ~Log()
     {
+        mStream.clear();
         if (mLevel <= Debug::CurrentDebugLevel)
-            std::cout << std::endl;
+        {
+            // The buffer is rewound rather than replaced, so it may still hold the tail of a longer previous line
+            const std::streamoff length = mStream.tellp();
+            std::string line = mStream.str();
+            line.resize(static_cast<std::size_t>(length));
+            Debug::writeLogLine(std::move(line));
+        }
+        mStream.seekp(0);
     }
 
 private:
+    // Reused for every line logged by the thread, so formatting only allocates once the buffer outgrows the longest
+    // line so far. The finished line handed over to be written is still a copy.
+    static std::ostringstream& getStream()
+    {
+        thread_local std::ostringstream stream;
+        return stream;
+    }
+
     Debug::Level mLevel;
+    std::ostringstream& mStream;
 };
 
 #endif
@@ -0,0 +1,97 @@
+#include "asyncpathfinder.hpp"
+#include "findsmoothpath.hpp"
+#include "navigator.hpp"
+#include "settings.hpp"
+#include "settingsutils.hpp"
+
+#include <components/debug/debuglog.hpp>
+
+#include <iterator>
+
+namespace DetourNavigator
+{
+    AsyncPathFinder::AsyncPathFinder(const Navigator& navigator, std::size_t threadsCount)
+        : mNavigator(navigator)
+        , mShouldStop(false)
+    {
+        for (std::size_t i = 0; i < threadsCount; ++i)
+            mThreads.emplace_back([&] { process(); });
+    }
+
+    AsyncPathFinder::~AsyncPathFinder()
+    {
+        mShouldStop = true;
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.clear();
+        }
+        mHasJob.notify_all();
+        for (auto& thread : mThreads)
+            thread.join();
+    }
+
+    std::shared_ptr<PathRequest> AsyncPathFinder::post(const PathQuery& query)
+    {
+        auto request = std::make_shared<PathRequest>(query, mNavigator.getNavMesh(query.mAgentHalfExtents));
+
+        if (!request->mNavMesh)
+        {
+            request->mDone = true;
+            return request;
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(mMutex);
+            mJobs.push_back(request);
+        }
+        mHasJob.notify_one();
+
+        return request;
+    }
+
+    void AsyncPathFinder::process() noexcept
+    {
+        Log(Debug::Debug) << "Start process path requests by thread=" << std::this_thread::get_id();
+        while (!mShouldStop)
+        {
+            std::shared_ptr<PathRequest> request;
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mHasJob.wait(lock, [&] { return mShouldStop || !mJobs.empty(); });
+                if (mShouldStop)
+                    break;
+                request = mJobs.front().lock();
+                mJobs.pop_front();
+            }
+
+            if (!request)
+                continue;
+
+            try
+            {
+                processRequest(*request);
+            }
+            catch (const std::exception& e)
+            {
+                Log(Debug::Error) << "AsyncPathFinder::process exception: " << e.what();
+                request->mPath.clear();
+                request->mStatus = Status::FindPathOverPolygonsFailed;
+            }
+
+            request->mNavMesh.reset();
+            request->mDone.store(true, std::memory_order_release);
+        }
+        Log(Debug::Debug) << "Stop path requests processing by thread=" << std::this_thread::get_id();
+    }
+
+    void AsyncPathFinder::processRequest(PathRequest& request) const
+    {
+        const PathQuery& query = request.mQuery;
+        const Settings& settings = mNavigator.getSettings();
+        auto out = std::back_inserter(request.mPath);
+        request.mStatus = findSmoothPath(request.mNavMesh->lockConst()->getImpl(),
+            toNavMeshCoordinates(settings, query.mAgentHalfExtents), toNavMeshCoordinates(settings, query.mStepSize),
+            toNavMeshCoordinates(settings, query.mStart), toNavMeshCoordinates(settings, query.mEnd),
+            query.mIncludeFlags, query.mAreaCosts, settings, out);
+    }
+}
@@ -0,0 +1,89 @@
+#ifndef OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+#define OPENMW_COMPONENTS_DETOURNAVIGATOR_ASYNCPATHFINDER_H
+
+#include "areatype.hpp"
+#include "flags.hpp"
+#include "navmeshcacheitem.hpp"
+#include "status.hpp"
+
+#include <osg/Vec3f>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace DetourNavigator
+{
+    struct Settings;
+    struct Navigator;
+
+    struct PathQuery
+    {
+        osg::Vec3f mAgentHalfExtents;
+        float mStepSize;
+        osg::Vec3f mStart;
+        osg::Vec3f mEnd;
+        Flags mIncludeFlags;
+        AreaCosts mAreaCosts;
+    };
+
+    /// @brief Result of a path query processed by AsyncPathFinder.
+    /// @note Status and path may be read only after isDone() returned true.
+    class PathRequest
+    {
+    public:
+        PathRequest(const PathQuery& query, SharedNavMeshCacheItem navMesh)
+            : mQuery(query), mNavMesh(std::move(navMesh)), mStatus(Status::NavMeshNotFound), mDone(false)
+        {}
+
+        const PathQuery& getQuery() const { return mQuery; }
+
+        bool isDone() const { return mDone.load(std::memory_order_acquire); }
+
+        Status getStatus() const { return mStatus; }
+
+        const std::deque<osg::Vec3f>& getPath() const { return mPath; }
+
+    private:
+        friend class AsyncPathFinder;
+
+        const PathQuery mQuery;
+        SharedNavMeshCacheItem mNavMesh;
+        Status mStatus;
+        std::deque<osg::Vec3f> mPath;
+        std::atomic_bool mDone;
+    };
+
+    /// @brief Resolves path queries on background threads.
+    /// @par The navmesh for the agent is looked up on post(), so workers never touch the navigator itself.
+    /// Requests which are released by their owner before a worker picks them up are skipped.
+    /// @note Workers search the live nav mesh, not a copy. A search holds the nav mesh lock for its whole duration,
+    /// like Navigator::findPath does, so searches over the nav mesh of the same agent size run one at a time
+    /// and wait while AsyncNavMeshUpdater adds or removes tiles.
+    class AsyncPathFinder
+    {
+    public:
+        AsyncPathFinder(const Navigator& navigator, std::size_t threadsCount);
+        ~AsyncPathFinder();
+
+        std::shared_ptr<PathRequest> post(const PathQuery& query);
+
+    private:
+        const Navigator& mNavigator;
+        std::atomic_bool mShouldStop;
+        std::mutex mMutex;
+        std::condition_variable mHasJob;
+        std::deque<std::weak_ptr<PathRequest>> mJobs;
+        std::vector<std::thread> mThreads;
+
+        void process() noexcept;
+
+        void processRequest(PathRequest& request) const;
+    };
+}
+
+#endif
@@ -1,6 +1,11 @@
 #include "storage.hpp"
 
+#include <algorithm>
+#include <future>
+#include <optional>
 #include <set>
+#include <thread>
+#include <vector>
 
 #include <osg/Image>
 #include <osg/Plane>
@@ -8,18 +13,102 @@
 #include <components/debug/debuglog.hpp>
 #include <components/misc/resourcehelpers.hpp>
 #include <components/misc/stringops.hpp>
+#include <components/terrain/vertexcache.hpp>
 #include <components/vfs/manager.hpp>
 
 namespace ESMTerrain
 {
 
+    /// @brief Land objects used while building a terrain chunk.
+    /// @note Cells inside the grid given on construction are stored in a flat array. Once all of them have been
+    ///       inserted, looking them up does not modify the cache, so it may be read from several threads.
     class LandCache
     {
     public:
+        LandCache(int offsetX = 0, int offsetY = 0, int size = 0)
+            : mOffsetX(offsetX)
+            , mOffsetY(offsetY)
+            , mSize(size)
+            , mGrid(static_cast<size_t>(size * size))
+        {
+        }
+
+        /// @return true if the cell was resolved before, even when it has no land
+        bool find(int cellX, int cellY, const LandObject*& land) const
+        {
+            if (isInGrid(cellX, cellY))
+            {
+                const std::optional<osg::ref_ptr<const LandObject>>& value = mGrid[getIndex(cellX, cellY)];
+                if (!value)
+                    return false;
+                land = value->get();
+                return true;
+            }
+
+            Map::const_iterator found = mMap.find(std::make_pair(cellX, cellY));
+            if (found == mMap.end())
+                return false;
+            land = found->second;
+            return true;
+        }
+
+        const LandObject* insert(int cellX, int cellY, osg::ref_ptr<const LandObject>&& land)
+        {
+            if (isInGrid(cellX, cellY))
+                return mGrid[getIndex(cellX, cellY)].emplace(std::move(land)).get();
+            return mMap.emplace(std::make_pair(cellX, cellY), std::move(land)).first->second;
+        }
+
+    private:
         typedef std::map<std::pair<int, int>, osg::ref_ptr<const LandObject> > Map;
+
+        int mOffsetX;
+        int mOffsetY;
+        int mSize;
+        std::vector<std::optional<osg::ref_ptr<const LandObject>>> mGrid;
         Map mMap;
+
+        bool isInGrid(int cellX, int cellY) const
+        {
+            return cellX >= mOffsetX && cellX < mOffsetX + mSize && cellY >= mOffsetY && cellY < mOffsetY + mSize;
+        }
+
+        size_t getIndex(int cellX, int cellY) const
+        {
+            return static_cast<size_t>((cellY - mOffsetY) * mSize + (cellX - mOffsetX));
+        }
     };
 
+    namespace
+    {
+        /// Minimum number of vertices for a chunk to be generated on several threads.
+        /// Chunks have 65x65 vertices with the default 'vertex lod mod' of 0, so only a positive value reaches this.
+        constexpr size_t minParallelVertices = 129 * 129;
+
+        /// Call function for each index in [0, count), spreading the indices over several threads.
+        /// The calling thread takes part in the work and returns once every index has been processed.
+        template <class Function>
+        void runInParallel(int count, const Function& function)
+        {
+            const int numThreads = std::max(1, std::min(count, static_cast<int>(std::thread::hardware_concurrency())));
+
+            std::vector<std::future<void>> tasks;
+            tasks.reserve(numThreads - 1);
+            for (int thread = 1; thread < numThreads; ++thread)
+                tasks.push_back(std::async(std::launch::async, [&, thread]
+                {
+                    for (int i = thread; i < count; i += numThreads)
+                        function(i);
+                }));
+
+            for (int i = 0; i < count; i += numThreads)
+                function(i);
+
+            for (std::future<void>& task : tasks)
+                task.get();
+        }
+    }
+
     LandObject::LandObject()
         : mLand(nullptr)
         , mLoadFlags(0)
@@ -176,8 +265,11 @@ namespace ESMTerrain
                                             osg::ref_ptr<osg::Vec3Array> normals,
                                             osg::ref_ptr<osg::Vec4ubArray> colours)
     {
+        if (mVertexCache && mVertexCache->fillVertexBuffers(lodLevel, size, center, *positions, *normals, *colours))
+            return;
+
         // LOD level n means every 2^n-th vertex is kept
-        size_t increment = static_cast<size_t>(1) << lodLevel;
+        int increment = 1 << lodLevel;
 
         osg::Vec2f origin = center - osg::Vec2f(size/2.f, size/2.f);
 
@@ -190,128 +282,187 @@ namespace ESMTerrain
         normals->resize(numVerts*numVerts);
         colours->resize(numVerts*numVerts);
 
-        osg::Vec3f normal;
-        osg::Vec4ub color;
+        const int numCells = static_cast<int>(std::ceil(size));
 
-        float vertY = 0;
-        float vertX = 0;
+        bool alteration = useAlteration();
 
-        LandCache cache;
+        // Every land object the chunk needs is resolved only once, including a ring of neighbours used to fix up the
+        // normals and colours at the chunk borders.
+        const int cacheSize = numCells + 2;
+        LandCache cache(startCellX - 1, startCellY - 1, cacheSize);
 
-        bool alteration = useAlteration();
+        // Chunks are already built on the terrain worker threads, so only split the most detailed ones further into
+        // independent rows of cells. For chunks of the usual size starting threads costs more than it saves.
+        // Altered terrain (the editor) keeps the serial path, its storage is not meant to be shared between threads.
+        const bool parallel = !alteration && numCells > 1 && numVerts * numVerts >= minParallelVertices;
+
+        // The parallel path resolves all of them up front, so that the cache is only read from afterwards.
+        if (parallel)
+        {
+            for (int y = 0; y < cacheSize; ++y)
+                for (int x = 0; x < cacheSize; ++x)
+                    cache.insert(startCellX - 1 + x, startCellY - 1 + y, getLand(startCellX - 1 + x, startCellY - 1 + y));
+        }
+
+        // Skip the first row / column unless we're at a chunk edge,
+        // since this row / column is already contained in a previous cell
+        // This is only relevant if we're creating a chunk spanning multiple cells
+        // The start offsets are only relevant for chunks smaller than (contained in) one cell
+        const auto getVertexRange = [&] (int cellIndex, float originOffset, int& start, int& end)
+        {
+            start = cellIndex != 0 ? increment : 0;
+            start += originOffset * ESM::Land::LAND_SIZE;
+            end = std::min(static_cast<int>(start + std::min(1.f, size) * (ESM::Land::LAND_SIZE-1) + 1), static_cast<int>(ESM::Land::LAND_SIZE));
+        };
 
-        float vertY_ = 0; // of current cell corner
-        for (int cellY = startCellY; cellY < startCellY + std::ceil(size); ++cellY)
+        const auto countVertices = [&] (int start, int end)
+        {
+            return (end - start + increment - 1) / increment;
+        };
+
+        // Every cell but the first one in a row / column contributes the same number of vertices
+        int rowStart, rowEnd, colStart, colEnd;
+        getVertexRange(0, origin.x() - startCellX, rowStart, rowEnd);
+        getVertexRange(0, origin.y() - startCellY, colStart, colEnd);
+        const int firstRowVerts = countVertices(rowStart, rowEnd);
+        const int firstColVerts = countVertices(colStart, colEnd);
+        getVertexRange(1, origin.x() - startCellX, rowStart, rowEnd);
+        getVertexRange(1, origin.y() - startCellY, colStart, colEnd);
+        const int nextRowVerts = countVertices(rowStart, rowEnd);
+        const int nextColVerts = countVertices(colStart, colEnd);
+
+        const auto fillCellRow = [&] (int cellIndexY)
         {
-            float vertX_ = 0; // of current cell corner
-            for (int cellX = startCellX; cellX < startCellX + std::ceil(size); ++cellX)
+            ChunkVertexRange range;
+            getVertexRange(cellIndexY, origin.y() - startCellY, range.mColStart, range.mColEnd);
+            range.mVertY = cellIndexY == 0 ? 0 : firstColVerts + (cellIndexY - 1) * nextColVerts;
+
+            for (int cellIndexX = 0; cellIndexX < numCells; ++cellIndexX)
             {
-                const LandObject* land = getLand(cellX, cellY, cache);
-                const ESM::Land::LandData *heightData = 0;
-                const ESM::Land::LandData *normalData = 0;
-                const ESM::Land::LandData *colourData = 0;
-                if (land)
-                {
-                    heightData = land->getData(ESM::Land::DATA_VHGT);
-                    normalData = land->getData(ESM::Land::DATA_VNML);
-                    colourData = land->getData(ESM::Land::DATA_VCLR);
-                }
+                getVertexRange(cellIndexX, origin.x() - startCellX, range.mRowStart, range.mRowEnd);
+                range.mVertX = cellIndexX == 0 ? 0 : firstRowVerts + (cellIndexX - 1) * nextRowVerts;
 
-                int rowStart = 0;
-                int colStart = 0;
-                // Skip the first row / column unless we're at a chunk edge,
-                // since this row / column is already contained in a previous cell
-                // This is only relevant if we're creating a chunk spanning multiple cells
-                if (vertY_ != 0)
-                    colStart += increment;
-                if (vertX_ != 0)
-                    rowStart += increment;
-
-                // Only relevant for chunks smaller than (contained in) one cell
-                rowStart += (origin.x() - startCellX) * ESM::Land::LAND_SIZE;
-                colStart += (origin.y() - startCellY) * ESM::Land::LAND_SIZE;
-                int rowEnd = std::min(static_cast<int>(rowStart + std::min(1.f, size) * (ESM::Land::LAND_SIZE-1) + 1), static_cast<int>(ESM::Land::LAND_SIZE));
-                int colEnd = std::min(static_cast<int>(colStart + std::min(1.f, size) * (ESM::Land::LAND_SIZE-1) + 1), static_cast<int>(ESM::Land::LAND_SIZE));
-
-                vertY = vertY_;
-                for (int col=colStart; col<colEnd; col += increment)
-                {
-                    vertX = vertX_;
-                    for (int row=rowStart; row<rowEnd; row += increment)
-                    {
-                        int srcArrayIndex = col*ESM::Land::LAND_SIZE*3+row*3;
+                fillCellVertices(startCellX + cellIndexX, startCellY + cellIndexY, range, increment, size, numVerts,
+                                 alteration, cache, *positions, *normals, *colours);
+            }
+        };
 
-                        assert(row >= 0 && row < ESM::Land::LAND_SIZE);
-                        assert(col >= 0 && col < ESM::Land::LAND_SIZE);
+        if (parallel)
+            runInParallel(numCells, fillCellRow);
+        else
+        {
+            for (int cellIndexY = 0; cellIndexY < numCells; ++cellIndexY)
+                fillCellRow(cellIndexY);
+        }
 
-                        assert (vertX < numVerts);
-                        assert (vertY < numVerts);
+        assert(static_cast<size_t>(firstRowVerts + (numCells - 1) * nextRowVerts) == numVerts); // Ensure we covered whole area
+        assert(static_cast<size_t>(firstColVerts + (numCells - 1) * nextColVerts) == numVerts);
+    }
 
-                        float height = defaultHeight;
-                        if (heightData)
-                            height = heightData->mHeights[col*ESM::Land::LAND_SIZE + row];
-                        if (alteration)
-                            height += getAlteredHeight(col, row);
-                        (*positions)[static_cast<unsigned int>(vertX*numVerts + vertY)]
-                            = osg::Vec3f((vertX / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits,
-                                         (vertY / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits,
-                                         height);
+    void Storage::fillCellVertices(int cellX, int cellY, const ChunkVertexRange& range, int increment, float size,
+                                   size_t numVerts, bool alteration, LandCache& cache,
+                                   osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours)
+    {
+        const LandObject* land = getLand(cellX, cellY, cache);
+        const ESM::Land::LandData *heightData = 0;
+        const ESM::Land::LandData *normalData = 0;
+        const ESM::Land::LandData *colourData = 0;
+        if (land)
+        {
+            heightData = land->getData(ESM::Land::DATA_VHGT);
+            normalData = land->getData(ESM::Land::DATA_VNML);
+            colourData = land->getData(ESM::Land::DATA_VCLR);
+        }
 
-                        if (normalData)
-                        {
-                            for (int i=0; i<3; ++i)
-                                normal[i] = normalData->mNormals[srcArrayIndex+i];
+        // Walk the cell one vertex row (along y) at a time, so that the destination indices are contiguous.
+        // Border fix-ups are applied at the end of each row.
+        size_t vertX = range.mVertX;
+        for (int row = range.mRowStart; row < range.mRowEnd; row += increment, ++vertX)
+        {
+            assert(row >= 0 && row < ESM::Land::LAND_SIZE);
+            assert(vertX < numVerts);
 
-                            normal.normalize();
-                        }
-                        else
-                            normal = osg::Vec3f(0,0,1);
+            const size_t base = vertX * numVerts + range.mVertY;
+            const float x = (vertX / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits;
 
-                        // Normals apparently don't connect seamlessly between cells
-                        if (col == ESM::Land::LAND_SIZE-1 || row == ESM::Land::LAND_SIZE-1)
-                            fixNormal(normal, cellX, cellY, col, row, cache);
+            size_t vertY = range.mVertY;
+            for (int col = range.mColStart; col < range.mColEnd; col += increment, ++vertY)
+            {
+                float height = heightData ? heightData->mHeights[col*ESM::Land::LAND_SIZE + row] : defaultHeight;
+                positions[vertX * numVerts + vertY] = osg::Vec3f(x, (vertY / float(numVerts - 1) - 0.5f) * size * Constants::CellSizeInUnits, height);
+            }
+            assert(vertY <= numVerts);
 
-                        // some corner normals appear to be complete garbage (z < 0)
-                        if ((row == 0 || row == ESM::Land::LAND_SIZE-1) && (col == 0 || col == ESM::Land::LAND_SIZE-1))
-                            averageNormal(normal, cellX, cellY, col, row, cache);
+            if (alteration)
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                    positions[i].z() += getAlteredHeight(col, row);
+            }
 
-                        assert(normal.z() > 0);
+            if (normalData)
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                {
+                    const ESM::Land::VNML* src = &normalData->mNormals[col*ESM::Land::LAND_SIZE*3+row*3];
+                    osg::Vec3f normal(src[0], src[1], src[2]);
+                    normal.normalize();
+                    normals[i] = normal;
+                }
+            }
+            else
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                    normals[i] = osg::Vec3f(0,0,1);
+            }
 
-                        (*normals)[static_cast<unsigned int>(vertX*numVerts + vertY)] = normal;
+            if (colourData)
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                {
+                    const unsigned char* src = &colourData->mColours[col*ESM::Land::LAND_SIZE*3+row*3];
+                    colours[i] = osg::Vec4ub(src[0], src[1], src[2], 255);
+                }
+            }
+            else
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                    colours[i] = osg::Vec4ub(255, 255, 255, 255);
+            }
 
-                        if (colourData)
-                        {
-                            for (int i=0; i<3; ++i)
-                                color[i] = colourData->mColours[srcArrayIndex+i];
-                        }
-                        else
-                        {
-                            color.r() = 255;
-                            color.g() = 255;
-                            color.b() = 255;
-                        }
-                        if (alteration)
-                            adjustColor(col, row, heightData, color); //Does nothing by default, override in OpenMW-CS
+            if (alteration)
+            {
+                size_t i = base;
+                for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+                    adjustColor(col, row, heightData, colours[i]); //Does nothing by default, override in OpenMW-CS
+            }
 
-                        // Unlike normals, colors mostly connect seamlessly between cells, but not always...
-                        if (col == ESM::Land::LAND_SIZE-1 || row == ESM::Land::LAND_SIZE-1)
-                            fixColour(color, cellX, cellY, col, row, cache);
+            // Only the last vertex row / column of a cell needs data from the neighbouring cells
+            const bool lastRow = row == ESM::Land::LAND_SIZE-1;
+            size_t i = base;
+            for (int col = range.mColStart; col < range.mColEnd; col += increment, ++i)
+            {
+                const bool lastCol = col == ESM::Land::LAND_SIZE-1;
 
-                        color.a() = 255;
+                // Normals apparently don't connect seamlessly between cells
+                if (lastCol || lastRow)
+                    fixNormal(normals[i], cellX, cellY, col, row, cache);
 
-                        (*colours)[static_cast<unsigned int>(vertX*numVerts + vertY)] = color;
+                // some corner normals appear to be complete garbage (z < 0)
+                if ((row == 0 || lastRow) && (col == 0 || lastCol))
+                    averageNormal(normals[i], cellX, cellY, col, row, cache);
 
-                        ++vertX;
-                    }
-                    ++vertY;
-                }
-                vertX_ = vertX;
-            }
-            vertY_ = vertY;
+                assert(normals[i].z() > 0);
 
-            assert(vertX_ == numVerts); // Ensure we covered whole area
+                // Unlike normals, colors mostly connect seamlessly between cells, but not always...
+                if (lastCol || lastRow)
+                    fixColour(colours[i], cellX, cellY, col, row, cache);
+            }
         }
-        assert(vertY_ == numVerts);  // Ensure we covered whole area
     }
 
     Storage::UniqueTextureId Storage::getVtexIndexAt(int cellX, int cellY,
@@ -525,14 +676,10 @@ namespace ESMTerrain
 
     const LandObject* Storage::getLand(int cellX, int cellY, LandCache& cache)
     {
-        LandCache::Map::iterator found = cache.mMap.find(std::make_pair(cellX, cellY));
-        if (found != cache.mMap.end())
-            return found->second;
-        else
-        {
-            found = cache.mMap.insert(std::make_pair(std::make_pair(cellX, cellY), getLand(cellX, cellY))).first;
-            return found->second;
-        }
+        const LandObject* land = nullptr;
+        if (cache.find(cellX, cellY, land))
+            return land;
+        return cache.insert(cellX, cellY, getLand(cellX, cellY));
     }
 
     void Storage::adjustColor(int col, int row, const ESM::Land::LandData *heightData, osg::Vec4ub& color) const
@@ -2,6 +2,7 @@
 #define COMPONENTS_ESM_TERRAIN_STORAGE_H
 
 #include <cassert>
+#include <memory>
 #include <mutex>
 
 #include <components/terrain/storage.hpp>
@@ -14,6 +15,11 @@ namespace VFS
     class Manager;
 }
 
+namespace Terrain
+{
+    class VertexCache;
+}
+
 namespace ESMTerrain
 {
 
@@ -108,6 +114,9 @@ namespace ESMTerrain
 
         int getBlendmapScale(float chunkSize) override;
 
+        /// Use vertex data generated ahead of time for the chunks it contains, instead of building them from the land data.
+        void setVertexCache(std::shared_ptr<const Terrain::VertexCache> cache) { mVertexCache = std::move(cache); }
+
         float getVertexHeight (const ESM::Land::LandData* data, int x, int y)
         {
             assert(x < ESM::Land::LAND_SIZE);
@@ -118,6 +127,25 @@ namespace ESMTerrain
     private:
         const VFS::Manager* mVFS;
 
+        std::shared_ptr<const Terrain::VertexCache> mVertexCache;
+
+        /// Vertex indices within a cell and the position of its first vertex in the chunk
+        struct ChunkVertexRange
+        {
+            int mRowStart;
+            int mRowEnd;
+            int mColStart;
+            int mColEnd;
+            size_t mVertX;
+            size_t mVertY;
+        };
+
+        /// Write the vertices of a single cell of a terrain chunk.
+        /// @note Only reads from the cache, if all neighbours of the cell have been resolved beforehand.
+        void fillCellVertices(int cellX, int cellY, const ChunkVertexRange& range, int increment, float size,
+                              size_t numVerts, bool alteration, LandCache& cache,
+                              osg::Vec3Array& positions, osg::Vec3Array& normals, osg::Vec4ubArray& colours);
+
         inline void fixNormal (osg::Vec3f& normal, int cellX, int cellY, int col, int row, LandCache& cache);
         inline void fixColour (osg::Vec4ub& colour, int cellX, int cellY, int col, int row, LandCache& cache);
         inline void averageNormal (osg::Vec3f& normal, int cellX, int cellY, int col, int row, LandCache& cache);
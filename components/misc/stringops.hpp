@@ -172,6 +172,26 @@ public:
         }
     };
 
+    struct CiEqual
+    {
+        bool operator()(const std::string& left, const std::string& right) const
+        {
+            return ciEqual(left, right);
+        }
+    };
+
+    /// Case-insensitive hash, to be used together with CiEqual
+    struct CiHash
+    {
+        std::size_t operator()(const std::string& str) const
+        {
+            std::size_t hash = 0;
+            for (char c : str)
+                hash ^= static_cast<unsigned char>(toLower(c)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
 
     /// Performs a binary search on a sorted container for a string that 'key' starts with
     template<typename Iterator, typename T>
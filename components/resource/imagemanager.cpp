@@ -1,6 +1,11 @@
 #include "imagemanager.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
 #include <osgDB/Registry>
 
 #include <components/debug/debuglog.hpp>
@@ -39,6 +44,106 @@ namespace
         return warningImage;
     }
 
+    std::uint32_t readUInt32(const char* data)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    void writeUInt32(char* data, std::uint32_t value)
+    {
+        std::memcpy(data, &value, sizeof(value));
+    }
+
+    /// Rewrite a mipmapped 2D DDS image so that its first mip level is no larger than maxSize, reading only the mip
+    /// levels that are kept. Returns nullptr if the image is already small enough or its format isn't handled here.
+    Files::IStreamPtr skipLargeDdsMipmaps(std::istream& stream, int maxSize)
+    {
+        // "DDS " followed by a DDS_HEADER
+        constexpr std::size_t headerSize = 4 + 124;
+        constexpr std::uint32_t ddsdPitch = 0x8;
+        constexpr std::uint32_t ddsdMipmapCount = 0x20000;
+        constexpr std::uint32_t ddsdLinearSize = 0x80000;
+        constexpr std::uint32_t ddpfFourCC = 0x4;
+        constexpr std::uint32_t ddsCaps2CubemapOrVolume = 0x200 | 0x200000;
+
+        std::string header(headerSize, '\0');
+        stream.read(&header[0], headerSize);
+        if (stream.gcount() != static_cast<std::streamsize>(headerSize) || header.compare(0, 4, "DDS ") != 0
+                || readUInt32(&header[4]) != 124)
+            return nullptr;
+
+        const std::uint32_t flags = readUInt32(&header[8]);
+        std::uint32_t height = readUInt32(&header[12]);
+        std::uint32_t width = readUInt32(&header[16]);
+        const std::uint32_t mipmapCount = (flags & ddsdMipmapCount) ? readUInt32(&header[28]) : 1;
+        const std::uint32_t pixelFormatFlags = readUInt32(&header[80]);
+        const std::uint32_t bitCount = readUInt32(&header[88]);
+        if (mipmapCount <= 1 || (readUInt32(&header[112]) & ddsCaps2CubemapOrVolume))
+            return nullptr;
+
+        std::uint32_t blockSize = 0;
+        if (pixelFormatFlags & ddpfFourCC)
+        {
+            const std::string fourCC = header.substr(84, 4);
+            if (fourCC == "DXT1" || fourCC == "ATI1" || fourCC == "BC4U")
+                blockSize = 8;
+            else if (fourCC == "DXT2" || fourCC == "DXT3" || fourCC == "DXT4" || fourCC == "DXT5"
+                    || fourCC == "ATI2" || fourCC == "BC5U")
+                blockSize = 16;
+            else
+                return nullptr;
+        }
+        else if (bitCount == 0 || bitCount % 8 != 0)
+            return nullptr;
+
+        const auto getLevelSize = [&] (std::uint32_t levelWidth, std::uint32_t levelHeight) -> std::size_t
+        {
+            if (blockSize != 0)
+                return std::size_t(std::max(1u, (levelWidth + 3) / 4)) * std::max(1u, (levelHeight + 3) / 4) * blockSize;
+            return std::size_t(levelWidth) * levelHeight * (bitCount / 8);
+        };
+
+        std::size_t skippedSize = 0;
+        std::uint32_t skippedLevels = 0;
+        while ((width > static_cast<std::uint32_t>(maxSize) || height > static_cast<std::uint32_t>(maxSize))
+               && skippedLevels + 1 < mipmapCount)
+        {
+            skippedSize += getLevelSize(width, height);
+            width = std::max(1u, width / 2);
+            height = std::max(1u, height / 2);
+            ++skippedLevels;
+        }
+        if (skippedLevels == 0)
+            return nullptr;
+
+        std::size_t keptSize = 0;
+        for (std::uint32_t level = skippedLevels, levelWidth = width, levelHeight = height; level < mipmapCount; ++level)
+        {
+            keptSize += getLevelSize(levelWidth, levelHeight);
+            levelWidth = std::max(1u, levelWidth / 2);
+            levelHeight = std::max(1u, levelHeight / 2);
+        }
+
+        writeUInt32(&header[12], height);
+        writeUInt32(&header[16], width);
+        writeUInt32(&header[28], mipmapCount - skippedLevels);
+        if (flags & ddsdLinearSize)
+            writeUInt32(&header[20], static_cast<std::uint32_t>(getLevelSize(width, height)));
+        else if (flags & ddsdPitch)
+            writeUInt32(&header[20], blockSize != 0 ? std::max(1u, (width + 3) / 4) * blockSize : width * (bitCount / 8));
+
+        std::string data = header;
+        data.resize(headerSize + keptSize);
+        stream.seekg(headerSize + skippedSize);
+        stream.read(&data[headerSize], keptSize);
+        if (stream.gcount() != static_cast<std::streamsize>(keptSize))
+            return nullptr;
+
+        return std::make_shared<std::istringstream>(std::move(data));
+    }
+
 }
 
 namespace Resource
@@ -48,6 +153,7 @@ namespace Resource
         : ResourceManager(vfs)
         , mWarningImage(createWarningImage())
         , mOptions(new osgDB::Options("dds_flip dds_dxt1_detect_rgba ignoreTga2Fields"))
+        , mMaxTextureSize(0)
     {
     }
 
@@ -137,6 +243,16 @@ namespace Resource
                 killAlpha = depth == 16 && alphaBPP == 1;
                 stream->seekg(0);
             }
+            else if (mMaxTextureSize > 0 && reader->supportedExtensions().count("dds"))
+            {
+                if (Files::IStreamPtr reduced = skipLargeDdsMipmaps(*stream, mMaxTextureSize))
+                    stream = reduced;
+                else
+                {
+                    stream->clear();
+                    stream->seekg(0);
+                }
+            }
 
             osgDB::ReaderWriter::ReadResult result = reader->readImage(*stream, mOptions);
             if (!result.success())
@@ -195,6 +311,11 @@ namespace Resource
         return mWarningImage;
     }
 
+    void ImageManager::setMaxTextureSize(int size)
+    {
+        mMaxTextureSize = size;
+    }
+
     void ImageManager::reportStats(unsigned int frameNumber, osg::Stats *stats) const
     {
         stats->setAttribute(frameNumber, "Image", mCache->getCacheSize());
@@ -32,11 +32,17 @@ namespace Resource
 
         osg::Image* getWarningImage();
 
+        /// Skip the mip levels of mipmapped DDS images which are larger than size in any dimension, so they are neither
+        /// read nor kept in memory. 0 disables the limit.
+        /// @note Not thread safe, should be set before images are loaded.
+        void setMaxTextureSize(int size);
+
         void reportStats(unsigned int frameNumber, osg::Stats* stats) const override;
 
     private:
         osg::ref_ptr<osg::Image> mWarningImage;
         osg::ref_ptr<osgDB::Options> mOptions;
+        int mMaxTextureSize;
 
         ImageManager(const ImageManager&);
         void operator = (const ImageManager&);
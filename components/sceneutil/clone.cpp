@@ -1,5 +1,8 @@
 #include "clone.hpp"
 
+#include <typeinfo>
+
+#include <osg/Geometry>
 #include <osg/StateSet>
 
 #include <osgParticle/ParticleProcessor>
@@ -9,6 +12,17 @@
 #include <components/sceneutil/morphgeometry.hpp>
 #include <components/sceneutil/riggeometry.hpp>
 
+namespace
+{
+    bool isShareable(const osg::Drawable& drawable)
+    {
+        return typeid(drawable) == typeid(osg::Geometry)
+            && drawable.getDataVariance() != osg::Object::DYNAMIC && !drawable.getUserDataContainer()
+            && !drawable.getUpdateCallback() && !drawable.getCullCallback() && !drawable.getEventCallback()
+            && !drawable.getDrawCallback() && !drawable.getComputeBoundingBoxCallback();
+    }
+}
+
 namespace SceneUtil
 {
 
@@ -24,6 +38,8 @@ namespace SceneUtil
     {
         if (const osgParticle::ParticleProcessor* processor = dynamic_cast<const osgParticle::ParticleProcessor*>(node))
             return operator()(processor);
+        if (const osg::Drawable* drawable = node->asDrawable())
+            return operator()(drawable);
         if (const osgParticle::ParticleSystemUpdater* updater = dynamic_cast<const osgParticle::ParticleSystemUpdater*>(node))
         {
             osgParticle::ParticleSystemUpdater* cloned = new osgParticle::ParticleSystemUpdater(*updater, osg::CopyOp::SHALLOW_COPY);
@@ -43,7 +59,12 @@ namespace SceneUtil
             return static_cast<osg::Drawable*>(drawable->clone(*this));
         }
 
-        return osg::CopyOp::operator()(drawable);
+        // Plain geometry gets its own drawable per instance, so that parent lists of the template never change,
+        // but shares the vertex arrays, primitive sets and state set with the template.
+        if (isShareable(*drawable))
+            return static_cast<osg::Drawable*>(drawable->clone(osg::CopyOp::SHALLOW_COPY));
+
+        return static_cast<osg::Drawable*>(drawable->clone(*this));
     }
 
     osgParticle::ParticleProcessor* CopyOp::operator() (const osgParticle::ParticleProcessor* processor) const
@@ -5,6 +5,11 @@
 
 #include <osg/CopyOp>
 
+namespace osg
+{
+    class Drawable;
+}
+
 namespace osgParticle
 {
     class ParticleProcessor;
@@ -18,6 +23,7 @@ namespace SceneUtil
     /// @par Defines the cloning behaviour we need:
     /// * Assigns updated ParticleSystem pointers on cloned emitters and programs.
     /// * Deep copies RigGeometry and MorphGeometry so they can animate without affecting clones.
+    /// * Shallow copies plain geometry without callbacks, sharing its arrays, primitive sets and state set.
     /// @warning Do not use an object of this class for more than one copy operation.
     class CopyOp : public osg::CopyOp
     {
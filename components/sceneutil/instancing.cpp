@@ -0,0 +1,157 @@
+#include "instancing.hpp"
+
+#include <typeinfo>
+
+#include <osg/Geode>
+#include <osg/Geometry>
+#include <osg/Group>
+#include <osg/Transform>
+#include <osg/Uniform>
+#include <osg/VertexAttribDivisor>
+
+#include <components/shader/shadermanager.hpp>
+
+namespace
+{
+    class InstancesBoundingBoxCallback : public osg::Drawable::ComputeBoundingBoxCallback
+    {
+    public:
+        InstancesBoundingBoxCallback(const osg::BoundingBox& box)
+            : mBox(box)
+        {
+        }
+
+        osg::BoundingBox computeBound(const osg::Drawable&) const override
+        {
+            return mBox;
+        }
+
+    private:
+        osg::BoundingBox mBox;
+    };
+
+    bool isPlainGroup(const osg::Node& node)
+    {
+        return typeid(node) == typeid(osg::Group) || typeid(node) == typeid(osg::Geode);
+    }
+
+    bool canInstanceNode(const osg::Node& node)
+    {
+        if (node.getUpdateCallback() || node.getCullCallback() || node.getEventCallback())
+            return false;
+
+        if (const osg::StateSet* stateset = node.getStateSet())
+        {
+            if (stateset->getRenderingHint() == osg::StateSet::TRANSPARENT_BIN)
+                return false;
+        }
+
+        if (const osg::Drawable* drawable = node.asDrawable())
+            return typeid(*drawable) == typeid(osg::Geometry) && !drawable->getDrawCallback();
+
+        if (const osg::Transform* transform = node.asTransform())
+        {
+            if (transform->getReferenceFrame() != osg::Transform::RELATIVE_RF)
+                return false;
+        }
+        else if (!isPlainGroup(node))
+            return false;
+
+        const osg::Group& group = *node.asGroup();
+        for (unsigned int i = 0; i < group.getNumChildren(); ++i)
+            if (!canInstanceNode(*group.getChild(i)))
+                return false;
+
+        return true;
+    }
+
+    osg::ref_ptr<osg::Geometry> createInstancedGeometry(const osg::Geometry& geometry, const osg::Matrix& local,
+        const std::vector<osg::Matrixf>& matrices)
+    {
+        osg::ref_ptr<osg::Geometry> result = new osg::Geometry(geometry, osg::CopyOp::SHALLOW_COPY);
+        result->setUseDisplayList(false);
+        result->setUseVertexBufferObjects(true);
+
+        const unsigned int numInstances = static_cast<unsigned int>(matrices.size());
+        result->removePrimitiveSet(0, result->getNumPrimitiveSets());
+        for (unsigned int i = 0; i < geometry.getNumPrimitiveSets(); ++i)
+        {
+            osg::ref_ptr<osg::PrimitiveSet> primitiveSet = osg::clone(geometry.getPrimitiveSet(i), osg::CopyOp::SHALLOW_COPY);
+            primitiveSet->setNumInstances(numInstances);
+            result->addPrimitiveSet(primitiveSet);
+        }
+
+        osg::ref_ptr<osg::Vec4Array> rows[3];
+        for (auto& row : rows)
+        {
+            row = new osg::Vec4Array(osg::Array::BIND_PER_VERTEX);
+            row->reserve(numInstances);
+        }
+
+        const osg::BoundingBox& geometryBox = geometry.getBoundingBox();
+        osg::BoundingBox box;
+        for (const osg::Matrixf& instance : matrices)
+        {
+            const osg::Matrixf matrix(local * osg::Matrix(instance));
+            for (int i = 0; i < 3; ++i)
+                rows[i]->push_back(osg::Vec4f(matrix(0, i), matrix(1, i), matrix(2, i), matrix(3, i)));
+            for (unsigned int corner = 0; corner < 8; ++corner)
+                box.expandBy(geometryBox.corner(corner) * matrix);
+        }
+
+        for (int i = 0; i < 3; ++i)
+            result->setVertexAttribArray(Shader::ShaderManager::sInstanceRowAttribLocations[i], rows[i], osg::Array::BIND_PER_VERTEX);
+
+        result->setComputeBoundingBoxCallback(new InstancesBoundingBoxCallback(box));
+        result->dirtyBound();
+        return result;
+    }
+
+    osg::ref_ptr<osg::Node> createInstancesNode(const osg::Node& node, const osg::Matrix& parentLocal,
+        const std::vector<osg::Matrixf>& matrices)
+    {
+        if (const osg::Geometry* geometry = node.asGeometry())
+            return createInstancedGeometry(*geometry, parentLocal, matrices);
+
+        osg::Matrix local(parentLocal);
+        if (const osg::Transform* transform = node.asTransform())
+            transform->computeLocalToWorldMatrix(local, nullptr);
+
+        // Transforms are replaced by groups keeping their state, since the matrix goes into the instance data
+        osg::ref_ptr<osg::Group> result = new osg::Group;
+        result->setStateSet(const_cast<osg::StateSet*>(node.getStateSet()));
+        result->setNodeMask(node.getNodeMask());
+        result->setName(node.getName());
+        result->setDataVariance(osg::Object::STATIC);
+
+        const osg::Group& group = *node.asGroup();
+        for (unsigned int i = 0; i < group.getNumChildren(); ++i)
+            result->addChild(createInstancesNode(*group.getChild(i), local, matrices));
+
+        return result;
+    }
+}
+
+namespace SceneUtil
+{
+
+    bool canInstance(const osg::Node& templateNode)
+    {
+        return canInstanceNode(templateNode);
+    }
+
+    osg::ref_ptr<osg::Node> createInstances(const osg::Node& templateNode, const std::vector<osg::Matrixf>& matrices)
+    {
+        osg::ref_ptr<osg::Group> root = new osg::Group;
+        root->setDataVariance(osg::Object::STATIC);
+
+        osg::StateSet* stateset = root->getOrCreateStateSet();
+        for (unsigned int location : Shader::ShaderManager::sInstanceRowAttribLocations)
+            stateset->setAttribute(new osg::VertexAttribDivisor(location, 1));
+        stateset->addUniform(new osg::Uniform("useInstancing", true));
+
+        root->addChild(createInstancesNode(templateNode, osg::Matrix(), matrices));
+        return root;
+    }
+
+}
@@ -0,0 +1,31 @@
+#ifndef OPENMW_COMPONENTS_SCENEUTIL_INSTANCING_H
+#define OPENMW_COMPONENTS_SCENEUTIL_INSTANCING_H
+
+#include <vector>
+
+#include <osg/Matrix>
+#include <osg/Matrixf>
+#include <osg/ref_ptr>
+
+namespace osg
+{
+    class Node;
+}
+
+namespace SceneUtil
+{
+
+    /// @brief Check if a template scene graph can be drawn by createInstances.
+    /// @par Only plain groups, relative transforms and osg::Geometry without callbacks are supported, and no
+    /// transparent geometry, since instances can not be depth sorted against each other.
+    bool canInstance(const osg::Node& templateNode);
+
+    /// @brief Create a graph drawing templateNode once per matrix, with a single instanced draw per geometry.
+    /// @par Transforms of the template are folded into the per-instance matrices, which are read by instancing.glsl,
+    /// so the result only renders correctly with shaders. Vertex data is shared with the template.
+    /// @note The matrices are expected to only rotate, translate and uniformly scale.
+    osg::ref_ptr<osg::Node> createInstances(const osg::Node& templateNode, const std::vector<osg::Matrixf>& matrices);
+
+}
+
+#endif
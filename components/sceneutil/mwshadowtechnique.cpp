@@ -24,8 +24,12 @@
 #include <osg/io_utils>
 #include <osg/Depth>
 
+#include <algorithm>
 #include <sstream>
 
+#include "morphgeometry.hpp"
+#include "riggeometry.hpp"
+
 namespace {
 
 using namespace osgShadow;
@@ -336,6 +340,92 @@ void VDSMCameraCullCallback::operator()(osg::Node* node, osg::NodeVisitor* nv)
     _projectionMatrix = cv->getProjectionMatrix();
 }
 
+//////////////////////////////////////////////////////////////////
+// CascadeCullVisitor
+//
+// Culls a single shadow map on a worker thread. Cull callbacks are not safe to run concurrently
+// (e.g. they animate or skin their subgraph once per frame), so subgraphs with a cull callback are
+// culled by one shadow map at a time. The same goes for RigGeometry and MorphGeometry, which update
+// themselves in accept(), so the group holding them is guarded as well.
+// Object roots of the active cells and paged objects near the player carry a LightListCallback,
+// so in practice only terrain and distant objects are culled concurrently.
+class CascadeCullVisitor : public osgUtil::CullVisitor
+{
+    public:
+
+        using osgUtil::CullVisitor::apply;
+
+        void apply(osg::Node& node) override { applyGuarded(node); }
+        void apply(osg::Geode& node) override { applyGuarded(node); }
+        void apply(osg::Drawable& drawable) override { applyGuarded(drawable); }
+        void apply(osg::Billboard& node) override { applyGuarded(node); }
+        void apply(osg::Switch& node) override { applyGuarded(node); }
+        void apply(osg::LOD& node) override { applyGuarded(node); }
+        void apply(osg::Group& node) override { applyGuarded(node); }
+        void apply(osg::Transform& node) override { applyGuarded(node); }
+
+    private:
+
+        static bool updatesOnCull(const osg::Node& node)
+        {
+            return node.asDrawable()
+                && (dynamic_cast<const SceneUtil::RigGeometry*>(&node) || dynamic_cast<const SceneUtil::MorphGeometry*>(&node));
+        }
+
+        static bool needsGuard(const osg::Node& node)
+        {
+            if (node.getCullCallback() || updatesOnCull(node))
+                return true;
+
+            // the children's accept() is called while traversing this node
+            if (const osg::Group* group = node.asGroup())
+            {
+                for (unsigned int i = 0; i < group->getNumChildren(); ++i)
+                    if (updatesOnCull(*group->getChild(i)))
+                        return true;
+            }
+
+            return false;
+        }
+
+        template <class T>
+        void applyGuarded(T& node)
+        {
+            if (needsGuard(node))
+            {
+                std::lock_guard<std::recursive_mutex> lock(sCullCallbackMutex);
+                osgUtil::CullVisitor::apply(node);
+            }
+            else
+                osgUtil::CullVisitor::apply(node);
+        }
+
+        static std::recursive_mutex sCullCallbackMutex;
+};
+
+std::recursive_mutex CascadeCullVisitor::sCullCallbackMutex;
+
+class CullShadowMapWorkItem : public SceneUtil::WorkItem
+{
+    public:
+
+        CullShadowMapWorkItem(const MWShadowTechnique* vdsm, MWShadowTechnique::ShadowData* sd):
+            _vdsm(vdsm),
+            _sd(sd)
+        {
+        }
+
+        void doWork() override
+        {
+            _vdsm->cullShadowCastingScene(_sd->_cullVisitor.get(), _sd->_camera.get());
+        }
+
+    protected:
+
+        const MWShadowTechnique*            _vdsm;
+        MWShadowTechnique::ShadowData*      _sd;
+};
+
 } // namespace
 
 MWShadowTechnique::ComputeLightSpaceBounds::ComputeLightSpaceBounds(osg::Viewport* viewport, const osg::Matrixd& projectionMatrix, osg::Matrixd& viewMatrix) :
@@ -866,6 +956,16 @@ void SceneUtil::MWShadowTechnique::disableFrontFaceCulling()
         _shadowCastingStateSet->setMode(GL_CULL_FACE, osg::StateAttribute::OFF | osg::StateAttribute::OVERRIDE);
 }
 
+void SceneUtil::MWShadowTechnique::enableParallelCascadeCulling(unsigned int numThreads)
+{
+    _cullWorkQueue = numThreads > 0 ? new WorkQueue(numThreads) : nullptr;
+}
+
+void SceneUtil::MWShadowTechnique::disableParallelCascadeCulling()
+{
+    _cullWorkQueue = nullptr;
+}
+
 void SceneUtil::MWShadowTechnique::setupCastingShader(Shader::ShaderManager & shaderManager)
 {
     // This can't be part of the constructor as OSG mandates that there be a trivial constructor available
@@ -874,6 +974,7 @@ void SceneUtil::MWShadowTechnique::setupCastingShader(Shader::ShaderManager & sh
 
     _castingProgram->addShader(shaderManager.getShader("shadowcasting_vertex.glsl", Shader::ShaderManager::DefineMap(), osg::Shader::VERTEX));
     _castingProgram->addShader(shaderManager.getShader("shadowcasting_fragment.glsl", Shader::ShaderManager::DefineMap(), osg::Shader::FRAGMENT));
+    Shader::ShaderManager::bindInstancingAttribLocations(*_castingProgram);
 
     _shadowMapAlphaTestDisableUniform = shaderManager.getShadowMapAlphaTestDisableUniform();
     _shadowMapAlphaTestDisableUniform->setName("alphaTestShadows");
@@ -1169,6 +1270,16 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
         }
 #endif
 
+        struct ShadowMapSettings
+        {
+            osg::ref_ptr<VDSMCameraCullCallback> vdsmCallback;
+            double cascadeNear;
+            double cascadeFar;
+        };
+
+        ShadowDataList shadowMaps;
+        std::vector<ShadowMapSettings> shadowMapSettings;
+
         // 4. For each light/shadow map
         for (unsigned int sm_i=0; sm_i<numShadowMapsPerLight; ++sm_i)
         {
@@ -1327,14 +1438,22 @@ void MWShadowTechnique::cull(osgUtil::CullVisitor& cv)
             osg::ref_ptr<VDSMCameraCullCallback> vdsmCallback = new VDSMCameraCullCallback(this, local_polytope);
             camera->setCullCallback(vdsmCallback.get());
 
-            // 4.3 traverse RTT camera
-            //
-
-            cv.pushStateSet(_shadowCastingStateSet.get());
+            shadowMaps.push_back(sd);
+            shadowMapSettings.push_back({vdsmCallback, cascaseNear, cascadeFar});
+        }
 
-            cullShadowCastingScene(&cv, camera.get());
+        // 4.3 traverse RTT cameras
+        //
+        cullShadowCastingScenes(&cv, shadowMaps);
 
-            cv.popStateSet();
+        unsigned int sm_i = 0;
+        for (ShadowDataList::iterator sd_itr = shadowMaps.begin(); sd_itr != shadowMaps.end(); ++sd_itr, ++sm_i)
+        {
+            osg::ref_ptr<ShadowData> sd = *sd_itr;
+            osg::ref_ptr<osg::Camera> camera = sd->_camera;
+            VDSMCameraCullCallback* vdsmCallback = shadowMapSettings[sm_i].vdsmCallback.get();
+            double cascaseNear = shadowMapSettings[sm_i].cascadeNear;
+            double cascadeFar = shadowMapSettings[sm_i].cascadeFar;
 
             if (!orthographicViewFrustum && settings->getShadowMapProjectionHint()==ShadowSettings::PERSPECTIVE_SHADOW_MAP)
             {
@@ -1585,6 +1704,7 @@ void MWShadowTechnique::createShaders()
     _shadowCastingStateSet->setTextureAttributeAndModes(0, _fallbackBaseTexture.get(), osg::StateAttribute::ON);
     _shadowCastingStateSet->addUniform(new osg::Uniform("useDiffuseMapForShadowAlpha", false));
     _shadowCastingStateSet->addUniform(_shadowMapAlphaTestDisableUniform);
+    _shadowCastingStateSet->addUniform(new osg::Uniform("useInstancing", false));
     osg::ref_ptr<osg::Depth> depth = new osg::Depth;
     depth->setWriteMask(true);
     _shadowCastingStateSet->setAttribute(depth, osg::StateAttribute::ON|osg::StateAttribute::OVERRIDE);
@@ -2978,6 +3098,82 @@ void MWShadowTechnique::cullShadowCastingScene(osgUtil::CullVisitor* cv, osg::Ca
     return;
 }
 
+void MWShadowTechnique::cullShadowCastingScenes(osgUtil::CullVisitor* cv, const ShadowDataList& shadowDataList) const
+{
+    OSG_INFO<<"cullShadowCastingScenes()"<<std::endl;
+
+    if (!_cullWorkQueue || shadowDataList.size() < 2)
+    {
+        for (const auto& sd : shadowDataList)
+        {
+            cv->pushStateSet(_shadowCastingStateSet.get());
+            cullShadowCastingScene(cv, sd->_camera.get());
+            cv->popStateSet();
+        }
+        return;
+    }
+
+    // the state graph of the main view, which the shadow maps inherit their state from
+    std::vector<const osg::StateSet*> inheritedStateSets;
+    for (osgUtil::StateGraph* sg = cv->getCurrentStateGraph(); sg; sg = sg->_parent)
+    {
+        if (sg->_stateset)
+            inheritedStateSets.push_back(sg->_stateset);
+    }
+    std::reverse(inheritedStateSets.begin(), inheritedStateSets.end());
+
+    // each shadow map gets its own CullVisitor, state graph and render stage. These are only reused by the next
+    // frame of the same view, as the ViewDependentData is per main CullVisitor.
+    for (const auto& sd : shadowDataList)
+    {
+        if (!sd->_cullVisitor)
+        {
+            sd->_cullVisitor = new CascadeCullVisitor;
+            sd->_stateGraph = new osgUtil::StateGraph;
+            sd->_renderStage = new osgUtil::RenderStage;
+        }
+
+        osgUtil::CullVisitor* shadowCv = sd->_cullVisitor.get();
+        sd->_stateGraph->clean();
+        sd->_renderStage->reset();
+        shadowCv->reset();
+        shadowCv->setCullSettings(*cv);
+        shadowCv->setTraversalMask(cv->getTraversalMask());
+        shadowCv->setFrameStamp(const_cast<osg::FrameStamp*>(cv->getFrameStamp()));
+        shadowCv->setTraversalNumber(cv->getTraversalNumber());
+        shadowCv->setRenderInfo(cv->getRenderInfo());
+        shadowCv->setStateGraph(sd->_stateGraph.get());
+        shadowCv->setRenderStage(sd->_renderStage.get());
+
+        for (const osg::StateSet* stateset : inheritedStateSets)
+            shadowCv->pushStateSet(stateset);
+        shadowCv->pushStateSet(_shadowCastingStateSet.get());
+    }
+
+    // the cull thread takes the first shadow map, the work queue the rest
+    std::vector<osg::ref_ptr<CullShadowMapWorkItem>> workItems;
+    for (ShadowDataList::const_iterator itr = std::next(shadowDataList.begin()); itr != shadowDataList.end(); ++itr)
+    {
+        workItems.emplace_back(new CullShadowMapWorkItem(this, itr->get()));
+        _cullWorkQueue->addWorkItem(workItems.back());
+    }
+
+    const ShadowData& first = *shadowDataList.front();
+    cullShadowCastingScene(first._cullVisitor.get(), first._camera.get());
+
+    for (const auto& workItem : workItems)
+        workItem->waitTillDone();
+
+    // hand the shadow maps' render stages over to the main view
+    osgUtil::RenderStage* currentStage = cv->getCurrentRenderBin()->getStage();
+    for (const auto& sd : shadowDataList)
+    {
+        for (const auto& preRenderStage : sd->_renderStage->getPreRenderList())
+            currentStage->addPreRenderStage(preRenderStage.second.get(), preRenderStage.first);
+        sd->_renderStage->getPreRenderList().clear();
+    }
+}
+
 osg::StateSet* MWShadowTechnique::selectStateSetForRenderingShadow(ViewDependentData& vdd, unsigned int traversalNumber) const
 {
     OSG_INFO<<"   selectStateSetForRenderingShadow() "<<vdd.getStateSet(traversalNumber)<<std::endl;
@@ -30,6 +30,9 @@
 
 #include <osgShadow/ShadowTechnique>
 
+#include <osgUtil/CullVisitor>
+
+#include <components/sceneutil/workqueue.hpp>
 #include <components/shader/shadermanager.hpp>
 #include <components/terrain/quadtreeworld.hpp>
 
@@ -85,6 +88,11 @@ namespace SceneUtil {
 
         virtual void disableFrontFaceCulling();
 
+        /** Cull the shadow maps of a light concurrently, using numThreads worker threads in addition to the cull thread.*/
+        virtual void enableParallelCascadeCulling(unsigned int numThreads);
+
+        virtual void disableParallelCascadeCulling();
+
         virtual void setupCastingShader(Shader::ShaderManager &shaderManager);
 
         class ComputeLightSpaceBounds : public osg::NodeVisitor, public osg::CullStack
@@ -176,6 +184,11 @@ namespace SceneUtil {
             osg::ref_ptr<osg::Texture2D>        _texture;
             osg::ref_ptr<osg::TexGen>           _texgen;
             osg::ref_ptr<osg::Camera>           _camera;
+
+            // used to cull _camera away from the main CullVisitor when parallel cascade culling is enabled
+            osg::ref_ptr<osgUtil::CullVisitor>  _cullVisitor;
+            osg::ref_ptr<osgUtil::StateGraph>   _stateGraph;
+            osg::ref_ptr<osgUtil::RenderStage>  _renderStage;
         };
 
         typedef std::list< osg::ref_ptr<ShadowData> > ShadowDataList;
@@ -231,6 +244,8 @@ namespace SceneUtil {
 
         virtual void cullShadowCastingScene(osgUtil::CullVisitor* cv, osg::Camera* camera) const;
 
+        virtual void cullShadowCastingScenes(osgUtil::CullVisitor* cv, const ShadowDataList& shadowDataList) const;
+
         virtual osg::StateSet* selectStateSetForRenderingShadow(ViewDependentData& vdd, unsigned int traversalNumber) const;
 
     protected:
@@ -263,6 +278,8 @@ namespace SceneUtil {
 
         float                                   _shadowFadeStart = 0.0;
 
+        osg::ref_ptr<WorkQueue>                 _cullWorkQueue;
+
         class DebugHUD final : public osg::Referenced
         {
         public:
@@ -46,6 +46,11 @@ namespace SceneUtil
         else if (Misc::StringUtils::lowerCase(computeSceneBounds) == "bounds")
             mShadowSettings->setComputeNearFarModeOverride(osg::CullSettings::COMPUTE_NEAR_FAR_USING_BOUNDING_VOLUMES);
 
+        if (Settings::Manager::getBool("parallel cascade culling", "Shadows"))
+            mShadowTechnique->enableParallelCascadeCulling(numberOfShadowMapsPerLight - 1);
+        else
+            mShadowTechnique->disableParallelCascadeCulling();
+
         int mapres = Settings::Manager::getInt("shadow map resolution", "Shadows");
         mShadowSettings->setTextureSize(osg::Vec2s(mapres, mapres));
 
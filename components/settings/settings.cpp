@@ -1,6 +1,8 @@
 #include "settings.hpp"
 #include "parser.hpp"
+#include "settingvalue.hpp"
 
+#include <mutex>
 #include <sstream>
 
 #include <components/misc/stringops.hpp>
@@ -12,6 +14,13 @@ CategorySettingValueMap Manager::mDefaultSettings = CategorySettingValueMap();
 CategorySettingValueMap Manager::mUserSettings = CategorySettingValueMap();
 CategorySettingVector Manager::mChangedSettings = CategorySettingVector();
 
+namespace
+{
+    // Handles may be created by function-local statics on any thread
+    std::mutex sValuesMutex;
+    std::multimap<CategorySetting, BaseSettingValue*> sValues;
+}
+
 void Manager::clear()
 {
     mDefaultSettings.clear();
@@ -23,12 +32,14 @@ void Manager::loadDefault(const std::string &file)
 {
     SettingsFileParser parser;
     parser.loadSettingsFile(file, mDefaultSettings);
+    updateValues();
 }
 
 void Manager::loadUser(const std::string &file)
 {
     SettingsFileParser parser;
     parser.loadSettingsFile(file, mUserSettings);
+    updateValues();
 }
 
 void Manager::saveUser(const std::string &file)
@@ -112,6 +123,8 @@ void Manager::setString(const std::string &setting, const std::string &category,
     mUserSettings[key] = value;
 
     mChangedSettings.insert(key);
+
+    updateValues(key);
 }
 
 void Manager::setInt (const std::string& setting, const std::string& category, const int value)
@@ -147,6 +160,41 @@ void Manager::setVector3 (const std::string &setting, const std::string &categor
     setString(setting, category, stream.str());
 }
 
+void Manager::registerValue(BaseSettingValue* value)
+{
+    std::lock_guard<std::mutex> lock(sValuesMutex);
+    sValues.emplace(value->getKey(), value);
+}
+
+void Manager::unregisterValue(BaseSettingValue* value)
+{
+    std::lock_guard<std::mutex> lock(sValuesMutex);
+    const auto range = sValues.equal_range(value->getKey());
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == value)
+        {
+            sValues.erase(it);
+            return;
+        }
+    }
+}
+
+void Manager::updateValues()
+{
+    std::lock_guard<std::mutex> lock(sValuesMutex);
+    for (const auto& value : sValues)
+        value.second->update();
+}
+
+void Manager::updateValues(const CategorySetting& key)
+{
+    std::lock_guard<std::mutex> lock(sValuesMutex);
+    const auto range = sValues.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
+        it->second->update();
+}
+
 void Manager::resetPendingChange(const std::string &setting, const std::string &category)
 {
     CategorySettingValueMap::key_type key = std::make_pair(category, setting);
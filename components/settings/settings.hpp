@@ -11,6 +11,8 @@
 
 namespace Settings
 {
+    class BaseSettingValue;
+
     ///
     /// \brief Settings management (can change during runtime)
     ///
@@ -55,6 +57,14 @@ namespace Settings
         static void setBool (const std::string& setting, const std::string& category, const bool value);
         static void setVector2 (const std::string& setting, const std::string& category, const osg::Vec2f value);
         static void setVector3 (const std::string& setting, const std::string& category, const osg::Vec3f value);
+
+        static void registerValue(BaseSettingValue* value);
+        static void unregisterValue(BaseSettingValue* value);
+        ///< keep a SettingValue up to date with changes of its setting, see SettingValue
+
+    private:
+        static void updateValues();
+        static void updateValues(const CategorySetting& key);
     };
 
 }
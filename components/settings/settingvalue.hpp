@@ -0,0 +1,91 @@
+#ifndef COMPONENTS_SETTINGS_SETTINGVALUE_H
+#define COMPONENTS_SETTINGS_SETTINGVALUE_H
+
+#include "settings.hpp"
+
+#include <atomic>
+#include <string>
+#include <type_traits>
+
+namespace Settings
+{
+    class BaseSettingValue
+    {
+    public:
+        BaseSettingValue(const std::string& setting, const std::string& category)
+            : mKey(category, setting)
+        {
+        }
+
+        virtual ~BaseSettingValue() = default;
+
+        BaseSettingValue(const BaseSettingValue&) = delete;
+        BaseSettingValue& operator=(const BaseSettingValue&) = delete;
+
+        const CategorySetting& getKey() const { return mKey; }
+
+        /// Parse the current value of the setting again. Called by Manager whenever it may have changed.
+        virtual void update() = 0;
+
+    private:
+        const CategorySetting mKey;
+    };
+
+    ///
+    /// \brief Typed handle of a single setting, holding its parsed value
+    ///
+    /// Reading a handle is an atomic load instead of a map lookup and a conversion from string, so it is meant to be
+    /// kept around (e.g. as a member or a function-local static) by code that reads a setting often.
+    /// Unlike a cached copy of the value, it follows changes made through Manager::setX and reloads of the settings files.
+    /// The change itself is still reported through Manager::getPendingChanges, for code that needs to react to it.
+    ///
+    template <class T>
+    class SettingValue final : public BaseSettingValue
+    {
+        static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float>,
+                      "Only settings that can be read atomically are supported");
+
+    public:
+        /// @note Throws like Manager::getX if the setting does not exist.
+        SettingValue(const std::string& setting, const std::string& category)
+            : BaseSettingValue(setting, category)
+        {
+            // Register first, so that a change made before the value is read below is not missed
+            Manager::registerValue(this);
+            try
+            {
+                update();
+            }
+            catch (...)
+            {
+                Manager::unregisterValue(this);
+                throw;
+            }
+        }
+
+        ~SettingValue() override
+        {
+            Manager::unregisterValue(this);
+        }
+
+        T get() const { return mValue.load(std::memory_order_relaxed); }
+
+        operator T() const { return get(); }
+
+        void update() override
+        {
+            const CategorySetting& key = getKey();
+            if constexpr (std::is_same_v<T, bool>)
+                mValue = Manager::getBool(key.second, key.first);
+            else if constexpr (std::is_same_v<T, int>)
+                mValue = Manager::getInt(key.second, key.first);
+            else
+                mValue = Manager::getFloat(key.second, key.first);
+        }
+
+    private:
+        std::atomic<T> mValue;
+    };
+}
+
+#endif
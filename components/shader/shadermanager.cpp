@@ -342,11 +342,19 @@ namespace Shader
             osg::ref_ptr<osg::Program> program (new osg::Program);
             program->addShader(vertexShader);
             program->addShader(fragmentShader);
+            bindInstancingAttribLocations(*program);
             found = mPrograms.insert(std::make_pair(std::make_pair(vertexShader, fragmentShader), program)).first;
         }
         return found->second;
     }
 
+    void ShaderManager::bindInstancingAttribLocations(osg::Program& program)
+    {
+        program.addBindAttribLocation("instanceRow0", sInstanceRowAttribLocations[0]);
+        program.addBindAttribLocation("instanceRow1", sInstanceRowAttribLocations[1]);
+        program.addBindAttribLocation("instanceRow2", sInstanceRowAttribLocations[2]);
+    }
+
     ShaderManager::DefineMap ShaderManager::getGlobalDefines()
     {
         return DefineMap(mGlobalDefines);
@@ -33,6 +33,13 @@ namespace Shader
 
         osg::ref_ptr<osg::Program> getProgram(osg::ref_ptr<osg::Shader> vertexShader, osg::ref_ptr<osg::Shader> fragmentShader);
 
+        /// Generic vertex attribute locations of the per-instance matrix rows read by instancing.glsl.
+        /// These are not aliased with any fixed function vertex array.
+        static constexpr unsigned int sInstanceRowAttribLocations[3] = {1, 6, 7};
+
+        /// Bind the attributes read by instancing.glsl. Done for every program made by getProgram.
+        static void bindInstancingAttribLocations(osg::Program& program);
+
         /// Get (a copy of) the DefineMap used to construct all shaders
         DefineMap getGlobalDefines();
 
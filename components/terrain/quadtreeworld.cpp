@@ -261,17 +261,15 @@ QuadTreeWorld::~QuadTreeWorld()
 {
 }
 
-/// get the level of vertex detail to render this node at, expressed relative to the native resolution of the data set.
-unsigned int getVertexLod(QuadTreeNode* node, int vertexLodMod)
+unsigned int getVertexLod(float size, int vertexLodMod)
 {
-    int lod = Log2(int(node->getSize()));
+    int lod = Log2(int(size));
     if (vertexLodMod > 0)
     {
         lod = std::max(0, lod-vertexLodMod);
     }
     else if (vertexLodMod < 0)
     {
-        float size = node->getSize();
         // Stop to simplify at this level since with size = 1 the node already covers the whole cell and has getCellVertices() vertices.
         while (size < 1)
         {
@@ -283,6 +281,12 @@ unsigned int getVertexLod(QuadTreeNode* node, int vertexLodMod)
     return lod;
 }
 
+/// get the level of vertex detail to render this node at, expressed relative to the native resolution of the data set.
+unsigned int getVertexLod(QuadTreeNode* node, int vertexLodMod)
+{
+    return getVertexLod(node->getSize(), vertexLodMod);
+}
+
 /// get the flags to use for stitching in the index buffer so that chunks of different LOD connect seamlessly
 unsigned int getLodFlags(QuadTreeNode* node, int ourLod, int vertexLodMod, const ViewData* vd)
 {
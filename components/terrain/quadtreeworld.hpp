@@ -16,6 +16,9 @@ namespace Terrain
     class RootNode;
     class ViewDataMap;
 
+    /// get the level of vertex detail to render a chunk of this size at, expressed relative to the native resolution of the data set.
+    unsigned int getVertexLod(float size, int vertexLodMod);
+
     /// @brief Terrain implementation that loads cells into a Quad Tree, with geometry LOD and texture LOD.
     class QuadTreeWorld : public TerrainGrid // note: derived from TerrainGrid is only to render default cells (see loadCell)
     {
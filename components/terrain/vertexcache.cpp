@@ -0,0 +1,293 @@
+#include "vertexcache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <tuple>
+
+#include <boost/filesystem.hpp>
+
+#include <components/debug/debuglog.hpp>
+#include <components/misc/stringops.hpp>
+
+namespace
+{
+    const char sMagic[4] = {'O', 'T', 'V', 'C'};
+    const std::uint32_t sVersion = 2;
+
+    const float sNormalScale = 32767.f;
+
+    template <class T>
+    void writeValue(std::ostream& stream, const T& value)
+    {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <class T>
+    void writeVector(std::ostream& stream, const std::vector<T>& values)
+    {
+        stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    template <class T>
+    void readValue(std::istream& stream, T& value)
+    {
+        stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+        if (!stream)
+            throw std::runtime_error("Unexpected end of terrain vertex cache");
+    }
+
+    template <class T>
+    void readVector(std::istream& stream, std::vector<T>& values, std::size_t size)
+    {
+        values.resize(size);
+        stream.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+        if (!stream)
+            throw std::runtime_error("Unexpected end of terrain vertex cache");
+    }
+}
+
+namespace Terrain
+{
+
+    VertexCache::ContentFile VertexCache::ContentFile::fromPath(const std::string& path)
+    {
+        const boost::filesystem::path file(path);
+        return ContentFile {
+            file.filename().string(),
+            static_cast<std::uint64_t>(boost::filesystem::file_size(file)),
+            static_cast<std::int64_t>(boost::filesystem::last_write_time(file))
+        };
+    }
+
+    bool VertexCache::ChunkKey::operator<(const ChunkKey& other) const
+    {
+        return std::tie(mLodLevel, mSize, mCenterX, mCenterY)
+            < std::tie(other.mLodLevel, other.mSize, other.mCenterX, other.mCenterY);
+    }
+
+    VertexCache::VertexCache(float cellWorldSize, int vertexLodMod)
+        : mCellWorldSize(cellWorldSize)
+        , mVertexLodMod(vertexLodMod)
+    {
+    }
+
+    void VertexCache::validate(const std::vector<ContentFile>& contentFiles, int vertexLodMod) const
+    {
+        if (vertexLodMod != mVertexLodMod)
+            throw std::runtime_error("generated with vertex lod mod " + std::to_string(mVertexLodMod)
+                + ", but " + std::to_string(vertexLodMod) + " is used");
+
+        if (contentFiles.size() != mContentFiles.size())
+            throw std::runtime_error("generated from " + std::to_string(mContentFiles.size())
+                + " content files, but " + std::to_string(contentFiles.size()) + " are loaded");
+
+        for (std::size_t i = 0; i < contentFiles.size(); ++i)
+        {
+            const ContentFile& baked = mContentFiles[i];
+            const ContentFile& loaded = contentFiles[i];
+            if (!Misc::StringUtils::ciEqual(baked.mName, loaded.mName))
+                throw std::runtime_error("generated from " + baked.mName + " instead of " + loaded.mName);
+            if (baked.mSize != loaded.mSize || baked.mModificationTime != loaded.mModificationTime)
+                throw std::runtime_error("generated before " + loaded.mName + " was changed");
+        }
+    }
+
+    void VertexCache::addChunk(int lodLevel, float size, const osg::Vec2f& center, const osg::Vec3Array& positions,
+                               const osg::Vec3Array& normals, const osg::Vec4ubArray& colours)
+    {
+        const std::size_t count = positions.size();
+
+        Chunk chunk;
+        chunk.mNumVerts = static_cast<unsigned int>(std::lround(std::sqrt(static_cast<double>(count))));
+        if (chunk.mNumVerts * chunk.mNumVerts != count || normals.size() != count || colours.size() != count)
+            throw std::runtime_error("Invalid terrain chunk vertex data");
+
+        chunk.mHeights.reserve(count);
+        chunk.mNormals.reserve(count * 3);
+        chunk.mColours.reserve(count * 3);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            chunk.mHeights.push_back(positions[i].z());
+            for (int j = 0; j < 3; ++j)
+            {
+                chunk.mNormals.push_back(static_cast<signed short>(std::lround(normals[i][j] * sNormalScale)));
+                chunk.mColours.push_back(colours[i][j]);
+            }
+        }
+
+        mChunks[ChunkKey {lodLevel, size, center.x(), center.y()}] = std::move(chunk);
+    }
+
+    bool VertexCache::fillVertexBuffers(int lodLevel, float size, const osg::Vec2f& center, osg::Vec3Array& positions,
+                                        osg::Vec3Array& normals, osg::Vec4ubArray& colours) const
+    {
+        const ChunkKey key {lodLevel, size, center.x(), center.y()};
+
+        const auto added = mChunks.find(key);
+        if (added != mChunks.end())
+        {
+            fillVertexBuffers(added->second, size, positions, normals, colours);
+            return true;
+        }
+
+        const auto located = mIndex.find(key);
+        if (located == mIndex.end())
+            return false;
+
+        Chunk chunk;
+        chunk.mNumVerts = located->second.mNumVerts;
+        const std::size_t count = static_cast<std::size_t>(chunk.mNumVerts) * chunk.mNumVerts;
+        try
+        {
+            const std::lock_guard<std::mutex> lock(mStreamMutex);
+            mStream->clear();
+            mStream->seekg(static_cast<std::streamoff>(located->second.mOffset));
+            readVector(*mStream, chunk.mHeights, count);
+            readVector(*mStream, chunk.mNormals, count * 3);
+            readVector(*mStream, chunk.mColours, count * 3);
+        }
+        catch (const std::exception& e)
+        {
+            Log(Debug::Warning) << "Warning: Failed to read terrain chunk from vertex cache: " << e.what();
+            return false;
+        }
+
+        fillVertexBuffers(chunk, size, positions, normals, colours);
+        return true;
+    }
+
+    void VertexCache::fillVertexBuffers(const Chunk& chunk, float size, osg::Vec3Array& positions,
+                                        osg::Vec3Array& normals, osg::Vec4ubArray& colours) const
+    {
+        const std::size_t numVerts = chunk.mNumVerts;
+
+        positions.resize(numVerts * numVerts);
+        normals.resize(numVerts * numVerts);
+        colours.resize(numVerts * numVerts);
+
+        // Same layout as ESMTerrain::Storage::fillVertexBuffers, which writes the vertex at (x, y) to x * numVerts + y
+        for (std::size_t vertX = 0; vertX < numVerts; ++vertX)
+        {
+            const float x = (vertX / float(numVerts - 1) - 0.5f) * size * mCellWorldSize;
+            for (std::size_t vertY = 0; vertY < numVerts; ++vertY)
+            {
+                const std::size_t i = vertX * numVerts + vertY;
+                positions[i] = osg::Vec3f(x, (vertY / float(numVerts - 1) - 0.5f) * size * mCellWorldSize, chunk.mHeights[i]);
+
+                osg::Vec3f normal(chunk.mNormals[i * 3], chunk.mNormals[i * 3 + 1], chunk.mNormals[i * 3 + 2]);
+                normal.normalize();
+                normals[i] = normal;
+
+                colours[i] = osg::Vec4ub(chunk.mColours[i * 3], chunk.mColours[i * 3 + 1], chunk.mColours[i * 3 + 2], 255);
+            }
+        }
+    }
+
+    void VertexCache::open(std::unique_ptr<std::istream> stream)
+    {
+        std::istream& input = *stream;
+
+        char magic[sizeof(sMagic)];
+        input.read(magic, sizeof(magic));
+        if (!input || !std::equal(std::begin(magic), std::end(magic), std::begin(sMagic)))
+            throw std::runtime_error("Not a terrain vertex cache");
+
+        std::uint32_t version = 0;
+        readValue(input, version);
+        if (version != sVersion)
+            throw std::runtime_error("Unsupported terrain vertex cache version " + std::to_string(version));
+
+        readValue(input, mCellWorldSize);
+
+        std::int32_t vertexLodMod = 0;
+        readValue(input, vertexLodMod);
+        mVertexLodMod = vertexLodMod;
+
+        std::uint32_t numContentFiles = 0;
+        readValue(input, numContentFiles);
+        mContentFiles.clear();
+        for (std::uint32_t i = 0; i < numContentFiles; ++i)
+        {
+            std::uint32_t length = 0;
+            readValue(input, length);
+            std::vector<char> name;
+            readVector(input, name, length);
+
+            ContentFile file;
+            file.mName.assign(name.begin(), name.end());
+            readValue(input, file.mSize);
+            readValue(input, file.mModificationTime);
+            mContentFiles.push_back(std::move(file));
+        }
+
+        std::uint32_t numChunks = 0;
+        readValue(input, numChunks);
+        mChunks.clear();
+        mIndex.clear();
+        for (std::uint32_t i = 0; i < numChunks; ++i)
+        {
+            ChunkKey key;
+            std::int32_t lodLevel = 0;
+            readValue(input, lodLevel);
+            readValue(input, key.mSize);
+            readValue(input, key.mCenterX);
+            readValue(input, key.mCenterY);
+            key.mLodLevel = lodLevel;
+
+            std::uint32_t numVerts = 0;
+            ChunkLocation location;
+            readValue(input, numVerts);
+            readValue(input, location.mOffset);
+            location.mNumVerts = numVerts;
+
+            mIndex.emplace(key, location);
+        }
+
+        mStream = std::move(stream);
+    }
+
+    void VertexCache::write(std::ostream& stream) const
+    {
+        stream.write(sMagic, sizeof(sMagic));
+        writeValue(stream, sVersion);
+        writeValue(stream, mCellWorldSize);
+        writeValue(stream, static_cast<std::int32_t>(mVertexLodMod));
+
+        writeValue(stream, static_cast<std::uint32_t>(mContentFiles.size()));
+        for (const ContentFile& file : mContentFiles)
+        {
+            writeValue(stream, static_cast<std::uint32_t>(file.mName.size()));
+            stream.write(file.mName.data(), file.mName.size());
+            writeValue(stream, file.mSize);
+            writeValue(stream, file.mModificationTime);
+        }
+
+        // The index comes first, so that opening the cache does not need to read the vertex data
+        const std::size_t indexEntrySize = sizeof(std::int32_t) + 3 * sizeof(float) + sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        writeValue(stream, static_cast<std::uint32_t>(mChunks.size()));
+        std::uint64_t offset = static_cast<std::uint64_t>(stream.tellp()) + mChunks.size() * indexEntrySize;
+        for (const auto& [key, chunk] : mChunks)
+        {
+            writeValue(stream, static_cast<std::int32_t>(key.mLodLevel));
+            writeValue(stream, key.mSize);
+            writeValue(stream, key.mCenterX);
+            writeValue(stream, key.mCenterY);
+            writeValue(stream, static_cast<std::uint32_t>(chunk.mNumVerts));
+            writeValue(stream, offset);
+            offset += chunk.mHeights.size() * sizeof(float) + chunk.mNormals.size() * sizeof(signed short)
+                + chunk.mColours.size() * sizeof(unsigned char);
+        }
+
+        for (const auto& [key, chunk] : mChunks)
+        {
+            writeVector(stream, chunk.mHeights);
+            writeVector(stream, chunk.mNormals);
+            writeVector(stream, chunk.mColours);
+        }
+    }
+
+}
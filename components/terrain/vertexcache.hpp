@@ -0,0 +1,113 @@
+#ifndef COMPONENTS_TERRAIN_VERTEXCACHE_H
+#define COMPONENTS_TERRAIN_VERTEXCACHE_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <osg/Array>
+#include <osg/Vec2f>
+
+namespace Terrain
+{
+
+    /// @brief Vertex data of terrain chunks generated ahead of time, e.g. by the terrainbake tool.
+    /// @note Positions are stored as heights only and normals are quantized, the layout of the filled
+    ///       buffers is the same as for Storage::fillVertexBuffers.
+    /// @note A cache opened from a stream only loads its index up front and reads chunks when they are requested.
+    ///       Reads are serialized, so the cache may be shared between threads.
+    class VertexCache
+    {
+    public:
+        /// Identifies the version of a content file the cache was generated from.
+        struct ContentFile
+        {
+            std::string mName;
+            std::uint64_t mSize;
+            std::int64_t mModificationTime;
+
+            /// @throw std::runtime_error if the file can not be accessed
+            static ContentFile fromPath(const std::string& path);
+        };
+
+        VertexCache(float cellWorldSize = 0.f, int vertexLodMod = 0);
+
+        float getCellWorldSize() const { return mCellWorldSize; }
+
+        /// The 'vertex lod mod' the chunks were generated with.
+        int getVertexLodMod() const { return mVertexLodMod; }
+
+        /// Content files the cache was generated from, in load order.
+        void setContentFiles(const std::vector<ContentFile>& files) { mContentFiles = files; }
+        const std::vector<ContentFile>& getContentFiles() const { return mContentFiles; }
+
+        /// Check that the cache was generated from \a contentFiles with \a vertexLodMod.
+        /// @throw std::runtime_error describing the first mismatch
+        void validate(const std::vector<ContentFile>& contentFiles, int vertexLodMod) const;
+
+        /// Store the vertex data of a chunk, as generated by Storage::fillVertexBuffers.
+        void addChunk(int lodLevel, float size, const osg::Vec2f& center, const osg::Vec3Array& positions,
+                      const osg::Vec3Array& normals, const osg::Vec4ubArray& colours);
+
+        /// Fill vertex buffers for a terrain chunk from the cache.
+        /// @return false if the chunk is not in the cache or can't be read, in which case the buffers are untouched
+        bool fillVertexBuffers(int lodLevel, float size, const osg::Vec2f& center, osg::Vec3Array& positions,
+                               osg::Vec3Array& normals, osg::Vec4ubArray& colours) const;
+
+        std::size_t getNumChunks() const { return mChunks.size() + mIndex.size(); }
+
+        /// Read the header and the chunk index, chunks are read from \a stream later on.
+        /// @throw std::runtime_error if the data is not a vertex cache or has an unsupported version
+        void open(std::unique_ptr<std::istream> stream);
+
+        /// Write the header and all chunks added by addChunk.
+        void write(std::ostream& stream) const;
+
+    private:
+        struct ChunkKey
+        {
+            int mLodLevel;
+            float mSize;
+            float mCenterX;
+            float mCenterY;
+
+            bool operator<(const ChunkKey& other) const;
+        };
+
+        struct Chunk
+        {
+            unsigned int mNumVerts; // per side
+            std::vector<float> mHeights;
+            std::vector<signed short> mNormals;
+            std::vector<unsigned char> mColours;
+        };
+
+        struct ChunkLocation
+        {
+            unsigned int mNumVerts;
+            std::uint64_t mOffset;
+        };
+
+        void fillVertexBuffers(const Chunk& chunk, float size, osg::Vec3Array& positions,
+                               osg::Vec3Array& normals, osg::Vec4ubArray& colours) const;
+
+        float mCellWorldSize;
+        int mVertexLodMod;
+        std::vector<ContentFile> mContentFiles;
+
+        // Chunks added by addChunk
+        std::map<ChunkKey, Chunk> mChunks;
+
+        // Chunks in the opened stream
+        std::map<ChunkKey, ChunkLocation> mIndex;
+        std::unique_ptr<std::istream> mStream;
+        mutable std::mutex mStreamMutex;
+    };
+
+}
+
+#endif
@@ -130,6 +130,7 @@ bool ViewData::Entry::set(QuadTreeNode *node)
 
 ViewData *ViewDataMap::getViewData(osg::Object *viewer, const osg::Vec3f& viewPoint, const osg::Vec4i &activeGrid, bool& needsUpdate)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     ViewerMap::const_iterator found = mViewers.find(viewer);
     ViewData* vd = nullptr;
     if (found == mViewers.end())
@@ -174,6 +175,7 @@ ViewData *ViewDataMap::getViewData(osg::Object *viewer, const osg::Vec3f& viewPo
 
 bool ViewDataMap::storeView(const ViewData* view, double referenceTime)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     if (view->getWorldUpdateRevision() < mWorldUpdateRevision)
         return false;
     ViewData* store = createOrReuseView();
@@ -209,6 +211,7 @@ ViewData *ViewDataMap::createIndependentView() const
 
 void ViewDataMap::clearUnusedViews(double referenceTime)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     for (ViewerMap::iterator it = mViewers.begin(); it != mViewers.end(); )
     {
         if (it->second->getLastUsageTimeStamp() + mExpiryDelay < referenceTime)
@@ -231,6 +234,7 @@ void ViewDataMap::clearUnusedViews(double referenceTime)
 
 void ViewDataMap::rebuildViews()
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     ++mWorldUpdateRevision;
 }
 
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <deque>
+#include <mutex>
 
 #include <osg/Node>
 
@@ -108,6 +109,9 @@ namespace Terrain
 
         std::deque<ViewData*> mUsedViews;
         std::deque<ViewData*> mUnusedViews;
+
+        // shadow maps may be culled in parallel
+        std::mutex mMutex;
     };
 
 }
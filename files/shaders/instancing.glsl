@@ -0,0 +1,23 @@
+// Instanced geometry carries the rows of its per-instance matrix in generic vertex attributes,
+// bound to fixed locations by Shader::ShaderManager. The matrix is applied in object space,
+// before gl_ModelViewMatrix, so the rest of a shader can treat the result like gl_Vertex.
+uniform bool useInstancing;
+
+attribute vec4 instanceRow0;
+attribute vec4 instanceRow1;
+attribute vec4 instanceRow2;
+
+vec4 getInstanceVertex(vec4 vertex)
+{
+    if (!useInstancing)
+        return vertex;
+    return vec4(dot(instanceRow0, vertex), dot(instanceRow1, vertex), dot(instanceRow2, vertex), vertex.w);
+}
+
+// Instances are only rotated and uniformly scaled, so directions can use the same matrix
+vec3 getInstanceDirection(vec3 direction)
+{
+    if (!useInstancing)
+        return direction;
+    return vec3(dot(instanceRow0.xyz, direction), dot(instanceRow1.xyz, direction), dot(instanceRow2.xyz, direction));
+}
@@ -50,21 +50,26 @@ centroid varying vec4 passColor;
 varying vec3 passViewPos;
 varying vec3 passNormal;
 
+#include "instancing.glsl"
+
 #include "shadows_vertex.glsl"
 
 #include "lighting.glsl"
 
 void main(void)
 {
-    gl_Position = gl_ModelViewProjectionMatrix * gl_Vertex;
+    vec4 vertex = getInstanceVertex(gl_Vertex);
+    vec3 normal = getInstanceDirection(gl_Normal);
+
+    gl_Position = gl_ModelViewProjectionMatrix * vertex;
 
-    vec4 viewPos = (gl_ModelViewMatrix * gl_Vertex);
+    vec4 viewPos = (gl_ModelViewMatrix * vertex);
     gl_ClipVertex = viewPos;
     euclideanDepth = length(viewPos.xyz);
     linearDepth = gl_Position.z;
 
 #if (@envMap || !PER_PIXEL_LIGHTING || @shadows_enabled)
-    vec3 viewNormal = normalize((gl_NormalMatrix * gl_Normal).xyz);
+    vec3 viewNormal = normalize((gl_NormalMatrix * normal).xyz);
 #endif
 
 #if @envMap
@@ -96,7 +101,7 @@ void main(void)
 
 #if @normalMap
     normalMapUV = (gl_TextureMatrix[@normalMapUV] * gl_MultiTexCoord@normalMapUV).xy;
-    passTangent = gl_MultiTexCoord7.xyzw;
+    passTangent = vec4(getInstanceDirection(gl_MultiTexCoord7.xyz), gl_MultiTexCoord7.w);
 #endif
 
 #if @bumpMap
@@ -112,7 +117,7 @@ void main(void)
 #endif
     passColor = gl_Color;
     passViewPos = viewPos.xyz;
-    passNormal = gl_Normal.xyz;
+    passNormal = normal.xyz;
 
 #if (@shadows_enabled)
     setupShadowCoords(viewPos, viewNormal);